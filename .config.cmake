@@ -22,6 +22,10 @@ if(BUILD_MULTI_THREAD)
     add_definitions(-DSUANPAN_MT)
 endif()
 
+if((USE_OPENBLAS) AND (NOT USE_NETLIB))
+    add_definitions(-DSUANPAN_OPENBLAS)
+endif()
+
 if(CMAKE_SYSTEM_NAME MATCHES "Windows") # WINDOWS PLATFORM
 
     if(CMAKE_CXX_COMPILER_ID MATCHES "GNU") # GNU GCC COMPILER
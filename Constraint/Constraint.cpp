@@ -51,3 +51,9 @@ const unsigned& Constraint::get_step_tag() const { return step_tag; }
  * \return Number of DoFs Modified
  */
 int Constraint::process(const shared_ptr<DomainBase>&) { return -1; }
+
+/**
+ * \brief Method to get DoFs coupled by the Constraint but not necessarily by any element.
+ * \return DoFs in the same labels as the DoF encoding of elements
+ */
+uvec Constraint::get_coupled_dof(const shared_ptr<DomainBase>&) const { return {}; }
@@ -47,6 +47,8 @@ public:
     const unsigned& get_step_tag() const;
 
     virtual int process(const shared_ptr<DomainBase>&) = 0;
+
+    virtual uvec get_coupled_dof(const shared_ptr<DomainBase>&) const;
 };
 
 #endif
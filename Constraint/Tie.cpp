@@ -51,3 +51,17 @@ int Tie::process(const shared_ptr<DomainBase>& D) {
 
     return 0;
 }
+
+uvec Tie::get_coupled_dof(const shared_ptr<DomainBase>& D) const {
+    if(!D->find_node(node_i) || !D->find_node(node_j)) return {};
+
+    auto& t_node_i = D->get_node(node_i);
+    auto& t_node_j = D->get_node(node_j);
+    if(!t_node_i->is_active() || !t_node_j->is_active()) return {};
+
+    auto& t_dof_i = t_node_i->get_reordered_dof();
+    auto& t_dof_j = t_node_j->get_reordered_dof();
+    if(dof_i == 0 || dof_j == 0 || dof_i > t_dof_i.n_elem || dof_j > t_dof_j.n_elem) return {};
+
+    return uvec{ t_dof_i(dof_i - 1), t_dof_j(dof_j - 1) };
+}
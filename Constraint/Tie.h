@@ -49,6 +49,8 @@ public:
     Tie(const unsigned& S, const unsigned& NA, const unsigned& DA, const unsigned& NB, const unsigned& DB);
 
     int process(const shared_ptr<DomainBase>&) override;
+
+    uvec get_coupled_dof(const shared_ptr<DomainBase>&) const override;
 };
 
 #endif
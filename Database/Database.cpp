@@ -24,6 +24,6 @@ Database::Database(const unsigned& T, const unsigned& CT)
 
 Database::~Database() { suanpan_debug("Database %u dtor() called.\n", get_tag()); }
 
-void Database::set_domain(const shared_ptr<DomainBase>& D) { domain = D; }
+void Database::set_domain(const weak_ptr<DomainBase>& D) { domain = D; }
 
-const shared_ptr<DomainBase>& Database::get_domain() const { return domain; }
+const weak_ptr<DomainBase>& Database::get_domain() const { return domain; }
@@ -17,6 +17,10 @@
 /**
  * @class Database
  * @brief A Database class is a top level container.
+ *
+ * A Database stores the committed state of the associated domain and restores
+ * it later on, which allows an interrupted analysis to be resumed.
+ *
  * @author T
  * @date 27/08/2017
  * @version 0.2.1
@@ -31,16 +35,17 @@
 class DomainBase;
 
 class Database : public Tag {
-    shared_ptr<DomainBase> domain = nullptr;
+    weak_ptr<DomainBase> domain;
 
 public:
     explicit Database(const unsigned& = 0, const unsigned& = 0);
     virtual ~Database();
 
-    void set_domain(const shared_ptr<DomainBase>& D);
-    const shared_ptr<DomainBase>& get_domain() const;
+    void set_domain(const weak_ptr<DomainBase>& D);
+    const weak_ptr<DomainBase>& get_domain() const;
 
     virtual int save() = 0;
+    virtual int load() = 0;
 };
 
 #endif
@@ -16,10 +16,287 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "HDF.h"
+#include <Domain/DomainBase.h>
+#include <Domain/Factory.hpp>
+#include <Domain/Node.h>
+#include <Element/Element.h>
+#include <Step/Step.h>
+#include <Toolbox/utility.h>
+#include <numeric>
+#ifndef SUANPAN_NO_HDF5
 #include <hdf5.h>
+#include <hdf5_hl.h>
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
 
-HDF::HDF(const char* N) { file_id = H5Fcreate(N, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT); }
+namespace {
+void write_data(const hid_t G, const char* N, const vec& D) {
+    const hsize_t t_size = D.n_elem;
+    H5LTmake_dataset(G, N, 1, &t_size, H5T_NATIVE_DOUBLE, D.memptr());
+}
 
-HDF::~HDF() { H5Fclose(file_id); }
+void write_data(const hid_t G, const char* N, const Col<unsigned>& D) {
+    const hsize_t t_size = D.n_elem;
+    H5LTmake_dataset(G, N, 1, &t_size, H5T_NATIVE_UINT, D.memptr());
+}
 
-int HDF::save() { return 0; }
+bool read_data(const hid_t G, const char* N, vec& D) {
+    hsize_t t_size = 0;
+    if(H5LTget_dataset_info(G, N, &t_size, nullptr, nullptr) < 0) return false;
+    D.set_size(t_size);
+    return t_size == 0 || H5LTread_dataset(G, N, H5T_NATIVE_DOUBLE, D.memptr()) >= 0;
+}
+
+bool read_data(const hid_t G, const char* N, Col<unsigned>& D) {
+    hsize_t t_size = 0;
+    if(H5LTget_dataset_info(G, N, &t_size, nullptr, nullptr) < 0) return false;
+    D.set_size(t_size);
+    return t_size == 0 || H5LTread_dataset(G, N, H5T_NATIVE_UINT, D.memptr()) >= 0;
+}
+
+// global vectors are only restored if the size matches the current model
+bool restore_vector(const hid_t G, const char* N, const vec& C, vec& D) {
+    if(!read_data(G, N, D)) return false;
+    return D.n_elem == C.n_elem;
+}
+}
+#endif
+
+HDF::HDF(const unsigned& T, const string& N)
+    : Database(T, CT_HDF)
+    , file_name(N) {}
+
+int HDF::save() {
+#ifdef SUANPAN_NO_HDF5
+    suanpan_error("save() requires HDF5 support.\n");
+    return -1;
+#else
+    const auto D = get_domain().lock();
+    if(D == nullptr) return -1;
+
+    const auto& W = D->get_factory();
+
+    const auto t_name = file_name + ".tmp";
+
+    std::lock_guard<std::mutex> t_guard(get_hdf5_mutex());
+
+    const auto t_file = H5Fcreate(t_name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    if(t_file < 0) {
+        suanpan_error("save() cannot create file %s.\n", t_name.c_str());
+        return -1;
+    }
+
+    // analysis progress: current step and the time left in it
+    const auto& t_step_tag = D->get_current_step_tag();
+    auto t_time_left = 0.;
+    if(D->find_step(t_step_tag)) t_time_left = std::max(0., D->get_step(t_step_tag)->get_time_period() - W->get_current_time() + D->get_step_start_time());
+
+    const auto t_group_step = H5Gcreate(t_file, "step", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    write_data(t_group_step, "tag", Col<unsigned>{ t_step_tag });
+    write_data(t_group_step, "time", vec{ t_time_left });
+    H5Gclose(t_group_step);
+
+    // committed global vectors
+    const auto t_group_factory = H5Gcreate(t_file, "factory", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    write_data(t_group_factory, "time", vec{ W->get_current_time() });
+    write_data(t_group_factory, "load_factor", W->get_current_load_factor());
+    write_data(t_group_factory, "load", W->get_current_load());
+    write_data(t_group_factory, "settlement", W->get_current_settlement());
+    write_data(t_group_factory, "resistance", W->get_current_resistance());
+    write_data(t_group_factory, "displacement", W->get_current_displacement());
+    write_data(t_group_factory, "velocity", W->get_current_velocity());
+    write_data(t_group_factory, "acceleration", W->get_current_acceleration());
+    write_data(t_group_factory, "temperature", W->get_current_temperature());
+    H5Gclose(t_group_factory);
+
+    // committed nodal status, four vectors of the size of dof number per node
+    const auto& t_node_pool = D->get_node_pool();
+    Col<unsigned> t_node_tag(t_node_pool.size());
+    vec t_node_data(std::accumulate(t_node_pool.cbegin(), t_node_pool.cend(), uword(0), [](const uword S, const shared_ptr<Node>& N) { return S + 4 * N->get_dof_number(); }));
+    uword t_node_idx = 0, t_node_pos = 0;
+    for(const auto& I : t_node_pool) {
+        t_node_tag(t_node_idx++) = I->get_tag();
+        for(const auto& J : { I->get_current_displacement(), I->get_current_velocity(), I->get_current_acceleration(), I->get_current_resistance() }) {
+            const auto t_size = std::min(uword(I->get_dof_number()), J.n_elem);
+            for(uword K = 0; K < t_size; ++K) t_node_data(t_node_pos + K) = J(K);
+            t_node_pos += I->get_dof_number();
+        }
+    }
+
+    const auto t_group_node = H5Gcreate(t_file, "node", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    write_data(t_group_node, "tag", t_node_tag);
+    write_data(t_group_node, "data", t_node_data);
+    H5Gclose(t_group_node);
+
+    // committed element status including material history of integration points
+    const auto& t_element_pool = D->get_element_pool();
+    Col<unsigned> t_element_tag(t_element_pool.size()), t_element_count(t_element_pool.size());
+    vector<vec> t_element_data;
+    uword t_element_idx = 0;
+    for(const auto& I : t_element_pool) {
+        const auto t_size = t_element_data.size();
+        I->save_status(t_element_data);
+        t_element_tag(t_element_idx) = I->get_tag();
+        t_element_count(t_element_idx++) = unsigned(t_element_data.size() - t_size);
+    }
+
+    Col<unsigned> t_element_size(t_element_data.size());
+    for(uword I = 0; I < t_element_size.n_elem; ++I) t_element_size(I) = unsigned(t_element_data[I].n_elem);
+
+    vec t_element_flat(accu(conv_to<uvec>::from(t_element_size)));
+    uword t_element_pos = 0;
+    for(const auto& I : t_element_data) {
+        if(I.n_elem != 0) arrayops::copy(t_element_flat.memptr() + t_element_pos, I.memptr(), I.n_elem);
+        t_element_pos += I.n_elem;
+    }
+
+    const auto t_group_element = H5Gcreate(t_file, "element", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    write_data(t_group_element, "tag", t_element_tag);
+    write_data(t_group_element, "count", t_element_count);
+    write_data(t_group_element, "size", t_element_size);
+    write_data(t_group_element, "data", t_element_flat);
+    H5Gclose(t_group_element);
+
+    H5Fclose(t_file);
+
+    // replace the previous checkpoint only after the new one is complete, the replacement itself is atomic
+#ifdef _WIN32
+    if(MoveFileExA(t_name.c_str(), file_name.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) == 0) {
+#else
+    if(std::rename(t_name.c_str(), file_name.c_str()) != 0) {
+#endif
+        suanpan_error("save() cannot write checkpoint to %s.\n", file_name.c_str());
+        return -1;
+    }
+
+    return 0;
+#endif
+}
+
+int HDF::load() {
+#ifdef SUANPAN_NO_HDF5
+    suanpan_error("load() requires HDF5 support.\n");
+    return -1;
+#else
+    const auto D = get_domain().lock();
+    if(D == nullptr) return -1;
+
+    const auto& W = D->get_factory();
+
+    std::lock_guard<std::mutex> t_guard(get_hdf5_mutex());
+
+    const auto t_file = H5Fopen(file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    if(t_file < 0) {
+        suanpan_error("load() cannot open file %s.\n", file_name.c_str());
+        return -1;
+    }
+
+    // committed global vectors
+    const auto t_group_factory = H5Gopen(t_file, "factory", H5P_DEFAULT);
+    vec t_time, t_load_factor, t_load, t_settlement, t_resistance, t_displacement, t_velocity, t_acceleration, t_temperature;
+    if(t_group_factory < 0 || !read_data(t_group_factory, "time", t_time) || t_time.is_empty() || !restore_vector(t_group_factory, "displacement", W->get_current_displacement(), t_displacement)) {
+        suanpan_error("load() finds checkpoint %s does not match current model.\n", file_name.c_str());
+        if(t_group_factory >= 0) H5Gclose(t_group_factory);
+        H5Fclose(t_file);
+        return -1;
+    }
+
+    W->set_current_time(t_time(0));
+    W->set_current_displacement(t_displacement);
+    if(restore_vector(t_group_factory, "load_factor", W->get_current_load_factor(), t_load_factor)) W->set_current_load_factor(t_load_factor);
+    if(restore_vector(t_group_factory, "load", W->get_current_load(), t_load)) W->set_current_load(t_load);
+    if(restore_vector(t_group_factory, "settlement", W->get_current_settlement(), t_settlement)) W->set_current_settlement(t_settlement);
+    if(restore_vector(t_group_factory, "resistance", W->get_current_resistance(), t_resistance)) W->set_current_resistance(t_resistance);
+    if(restore_vector(t_group_factory, "velocity", W->get_current_velocity(), t_velocity)) W->set_current_velocity(t_velocity);
+    if(restore_vector(t_group_factory, "acceleration", W->get_current_acceleration(), t_acceleration)) W->set_current_acceleration(t_acceleration);
+    if(restore_vector(t_group_factory, "temperature", W->get_current_temperature(), t_temperature)) W->set_current_temperature(t_temperature);
+    H5Gclose(t_group_factory);
+
+    // committed nodal status
+    const auto t_group_node = H5Gopen(t_file, "node", H5P_DEFAULT);
+    Col<unsigned> t_node_tag;
+    vec t_node_data;
+    if(t_group_node >= 0 && read_data(t_group_node, "tag", t_node_tag) && read_data(t_group_node, "data", t_node_data)) {
+        uword t_node_pos = 0;
+        for(const auto& I : t_node_tag) {
+            if(!D->find_node(I)) {
+                suanpan_warning("load() cannot find node %u, the rest nodal status is skipped.\n", I);
+                break;
+            }
+            auto& t_node = D->get_node(I);
+            const auto& t_dof = t_node->get_dof_number();
+            if(t_node_pos + 4 * t_dof > t_node_data.n_elem) break;
+            t_node->set_current_displacement(t_node_data.subvec(t_node_pos, t_node_pos + t_dof - 1));
+            t_node->set_current_velocity(t_node_data.subvec(t_node_pos + t_dof, t_node_pos + 2 * t_dof - 1));
+            t_node->set_current_acceleration(t_node_data.subvec(t_node_pos + 2 * t_dof, t_node_pos + 3 * t_dof - 1));
+            t_node->set_current_resistance(t_node_data.subvec(t_node_pos + 3 * t_dof, t_node_pos + 4 * t_dof - 1));
+            t_node_pos += 4 * t_dof;
+        }
+    }
+    if(t_group_node >= 0) H5Gclose(t_group_node);
+
+    // committed element status
+    const auto t_group_element = H5Gopen(t_file, "element", H5P_DEFAULT);
+    Col<unsigned> t_element_tag, t_element_count, t_element_size;
+    vec t_element_data;
+    if(t_group_element >= 0 && read_data(t_group_element, "tag", t_element_tag) && read_data(t_group_element, "count", t_element_count) && read_data(t_group_element, "size", t_element_size) && read_data(t_group_element, "data", t_element_data)) {
+        uword t_size_idx = 0, t_data_pos = 0;
+        for(uword I = 0; I < t_element_tag.n_elem; ++I) {
+            vector<vec> t_status;
+            t_status.reserve(t_element_count(I));
+            for(unsigned J = 0; J < t_element_count(I); ++J) {
+                const auto& t_length = t_element_size(t_size_idx++);
+                t_status.emplace_back(t_length == 0 ? vec() : vec(t_element_data.memptr() + t_data_pos, t_length));
+                t_data_pos += t_length;
+            }
+            if(!D->find_element(t_element_tag(I))) continue;
+            auto& t_element = D->get_element(t_element_tag(I));
+            // the layout must be identical to the one of the current model
+            vector<vec> t_layout;
+            t_element->save_status(t_layout);
+            if(t_layout.size() != t_status.size()) {
+                suanpan_warning("load() finds mismatched status of element %u, it is skipped.\n", t_element_tag(I));
+                continue;
+            }
+            auto t_iterator = t_status.cbegin();
+            t_element->load_status(t_iterator);
+        }
+    }
+    if(t_group_element >= 0) H5Gclose(t_group_element);
+
+    // analysis progress: steps finished are disabled and the current one is shortened
+    const auto t_group_step = H5Gopen(t_file, "step", H5P_DEFAULT);
+    Col<unsigned> t_step_tag;
+    vec t_time_left;
+    if(t_group_step >= 0 && read_data(t_group_step, "tag", t_step_tag) && read_data(t_group_step, "time", t_time_left) && !t_step_tag.is_empty() && !t_time_left.is_empty()) {
+        for(const auto& I : D->get_step_pool()) {
+            if(I.first < t_step_tag(0) || (I.first == t_step_tag(0) && t_time_left(0) <= 1E-14))
+                I.second->disable();
+            else if(I.first == t_step_tag(0)) {
+                I.second->set_time_perid(t_time_left(0));
+                if(I.second->get_ini_step_size() > t_time_left(0)) I.second->set_ini_step_size(t_time_left(0));
+            }
+        }
+    }
+    if(t_group_step >= 0) H5Gclose(t_group_step);
+
+    H5Fclose(t_file);
+
+    // rebuild trial status of all components from the restored committed status
+    D->reset_status();
+    if(D->update_trial_status() != 0) {
+        suanpan_error("load() cannot rebuild status from checkpoint %s.\n", file_name.c_str());
+        return -1;
+    }
+    D->commit_status();
+
+    suanpan_info("load() resumes analysis from time %.5f.\n", W->get_current_time());
+    suanpan_warning("load() recreates all recorder files, records before the restart are overwritten.\n");
+
+    return 0;
+#endif
+}
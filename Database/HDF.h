@@ -15,19 +15,37 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  ******************************************************************************/
 
+/**
+ * @class HDF
+ * @brief A HDF class writes checkpoints to HDF5 files.
+ *
+ * A checkpoint contains the committed global vectors of the factory, the
+ * committed status of all nodes and the committed status of all elements,
+ * including history variables of the integration points. The analysis can be
+ * resumed from the step and the time at which the checkpoint is written.
+ *
+ * The file is first written to a temporary file and then renamed so that an
+ * interruption during writing does not corrupt the last valid checkpoint.
+ *
+ * @author T
+ * @date 20/10/2017
+ * @version 0.1.0
+ * @file HDF.h
+ */
+
 #ifndef HDF_H
 #define HDF_H
 
 #include <Database/Database.h>
 
 class HDF : public Database {
-    hid_t file_id = 0;
+    const string file_name;
 
 public:
-    explicit HDF(const char*);
-    ~HDF();
+    explicit HDF(const unsigned& = 0, const string& = "checkpoint.h5");
 
     int save() override final;
+    int load() override final;
 };
 
 #endif
@@ -95,12 +95,7 @@ void ElementExample::initialize(const shared_ptr<DomainBase>& D) {
 }
 
 int ElementExample::update_status() {
-    vec trial_disp(m_node * m_dof);
-    auto idx = 0;
-    for(const auto& I : node_ptr) {
-        auto& tmp_disp = I.lock()->get_trial_displacement();
-        for(auto J = 0; J < m_dof; ++J) trial_disp(idx++) = tmp_disp(J);
-    }
+    const auto trial_disp = get_trial_displacement();
 
     m_material->update_trial_status(strain_mat * trial_disp);
 
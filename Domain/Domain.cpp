@@ -19,6 +19,7 @@
 #include <Constraint/Constraint.h>
 #include <Constraint/Criterion/Criterion.h>
 #include <Converger/Converger.h>
+#include <Database/Database.h>
 #include <Domain/Factory.hpp>
 #include <Domain/Node.h>
 #include <Element/Element.h>
@@ -30,21 +31,34 @@
 #include <Solver/Integrator/Integrator.h>
 #include <Solver/Solver.h>
 #include <Step/Step.h>
+#include <Toolbox/Profiler.h>
 #include <Toolbox/RCM.h>
+#include <Toolbox/ThreadPool.h>
+#include <Toolbox/utility.h>
+
+/**
+ * \brief Updates one element. If profiling is on, the elapsed time is charged
+ * to the element type and to the type of the section or material it refers to.
+ */
+int update_element(const Domain& D, const shared_ptr<Element>& E) {
+    if(!profiler::is_enabled()) return E->update_status();
+
+    wall_clock T;
+    T.tic();
+    const auto code = E->update_status();
+    const auto t_time = T.toc();
+
+    profiler::add_element(typeid(*E), t_time);
+
+    auto& t_section = E->get_section_tag();
+    auto& t_material = E->get_material_tag();
+    if(!t_section.is_empty() && D.find_section(unsigned(t_section(0))))
+        profiler::add_material(typeid(*D.get_section(unsigned(t_section(0)))), t_time);
+    else if(!t_material.is_empty() && D.find_material(unsigned(t_material(0))))
+        profiler::add_material(typeid(*D.get_material(unsigned(t_material(0)))), t_time);
 
-#ifdef SUANPAN_MT
-#ifdef SUANPAN_MSVC
-#include <ppl.h>
-#define suanpan_for_each Concurrency::parallel_for_each
-#elif defined(SUANPAN_INTEL)
-#include <tbb/parallel_for_each.h>
-#define suanpan_for_each tbb::parallel_for_each
-#else
-#define suanpan_for_each std::for_each
-#endif
-#else
-#define suanpan_for_each std::for_each
-#endif
+    return code;
+}
 
 Domain::Domain(const unsigned& T)
     : DomainBase(T)
@@ -131,6 +145,16 @@ bool Domain::insert(const shared_ptr<Step>& S) {
     return step_pond.insert({ S->get_tag(), S }).second;
 }
 
+bool Domain::insert(const vector<shared_ptr<Element>>& E) {
+    if(updated) updated = false;
+    return element_pond.insert(E);
+}
+
+bool Domain::insert(const vector<shared_ptr<Node>>& N) {
+    if(updated) updated = false;
+    return node_pond.insert(N);
+}
+
 bool Domain::erase_amplitude(const unsigned& T) {
     if(updated) updated = false;
     return amplitude_pond.erase(T);
@@ -430,7 +454,10 @@ bool Domain::find_solver(const unsigned& T) const { return solver_pond.find(T);
 
 bool Domain::find_step(const unsigned& T) const { return step_pond.find(T) != step_pond.end(); }
 
-void Domain::set_current_step_tag(const unsigned& T) { current_step_tag = T; }
+void Domain::set_current_step_tag(const unsigned& T) {
+    current_step_tag = T;
+    step_start_time = factory->get_current_time();
+}
 
 void Domain::set_current_converger_tag(const unsigned& T) { current_converger_tag = T; }
 
@@ -454,6 +481,20 @@ const shared_ptr<Integrator>& Domain::get_current_integrator() const { return ge
 
 const shared_ptr<Solver>& Domain::get_current_solver() const { return get_solver(current_solver_tag); }
 
+const double& Domain::get_step_start_time() const { return step_start_time; }
+
+void Domain::set_checkpoint(const shared_ptr<Database>& C, const unsigned& I) {
+    checkpoint = C;
+    checkpoint_interval = std::max(1u, I);
+    checkpoint_counter = 0;
+    if(checkpoint != nullptr) checkpoint->set_domain(shared_from_this());
+}
+
+void Domain::set_restart(const shared_ptr<Database>& R) {
+    restart = R;
+    if(restart != nullptr) restart->set_domain(shared_from_this());
+}
+
 bool Domain::insert_loaded_dof(const unsigned& T) { return loaded_dofs.insert(T).second; }
 
 bool Domain::insert_restrained_dof(const unsigned& T) { return restrained_dofs.insert(T).second; }
@@ -483,11 +524,16 @@ int Domain::initialize() {
         if(t_section.second->is_active()) t_section.second->initialize(shared_from_this());
     });
 
+    // nodal status lives in the global vectors, keep it before DoFs are renumbered
+    unordered_map<unsigned, vector<vec>> t_status;
+    if(!factory->get_current_displacement().is_empty())
+        for(const auto& t_node : node_pond) t_status[t_node.first] = { t_node.second->get_current_displacement(), t_node.second->get_current_velocity(), t_node.second->get_current_acceleration() };
+
     suanpan_for_each(node_pond.cbegin(), node_pond.cend(), [](const std::pair<unsigned, shared_ptr<Node>>& t_node) { t_node.second->set_dof_number(0); });
 
-    suanpan_for_each(element_pond.cbegin(), element_pond.cend(), [&](const std::pair<unsigned, shared_ptr<Element>>& t_element) {
+    // elements sharing a node write to it, the loop stays serial
+    for(const auto& t_element : element_pond)
         if(t_element.second->is_active()) t_element.second->Element::initialize(shared_from_this());
-    });
 
     suanpan_for_each(node_pond.cbegin(), node_pond.cend(), [&](const std::pair<unsigned, shared_ptr<Node>>& t_node) { t_node.second->initialize(shared_from_this()); });
 
@@ -521,6 +567,28 @@ int Domain::initialize() {
         for(const auto& i : t_encoding)
             for(const auto& j : t_encoding) adjacency[i].insert(j);
     }
+    // constraints may couple DoFs that share no element
+    for(const auto& t_constraint : constraint_pond.get()) {
+        const auto t_encoding = t_constraint->get_coupled_dof(shared_from_this());
+        for(const auto& i : t_encoding)
+            for(const auto& j : t_encoding) adjacency[i].insert(j);
+    }
+
+    // COLOR ELEMENTS SO THAT ELEMENTS OF THE SAME COLOR SHARE NO DOF
+    color_map.clear();
+    vector<vector<bool>> color_dof;
+    auto& t_active_element = element_pond.get();
+    for(unsigned i = 0; i < t_active_element.size(); ++i) {
+        auto& t_encoding = t_active_element[i]->get_dof_encoding();
+        unsigned t_color = 0;
+        while(t_color < color_dof.size() && std::any_of(t_encoding.cbegin(), t_encoding.cend(), [&](const uword& j) { return color_dof[t_color][j]; })) ++t_color;
+        if(t_color == color_dof.size()) {
+            color_dof.emplace_back(dof_counter, false);
+            color_map.emplace_back();
+        }
+        for(const auto& j : t_encoding) color_dof[t_color][j] = true;
+        color_map[t_color].emplace_back(i);
+    }
 
     // COUNT NUMBER OF DEGREE
     uvec num_degree(dof_counter);
@@ -551,10 +619,41 @@ int Domain::initialize() {
         }
     }
 
+    // GET SPARSE PATTERN IN NEW LABELS
+    uvec col_ptr(dof_counter + 1);
+    col_ptr(0) = 0;
+    for(unsigned i = 0; i < dof_counter; ++i) col_ptr(i + 1) = col_ptr(i) + num_degree(idx_rcm(i));
+    uvec row_idx(col_ptr(dof_counter));
+    for(unsigned i = 0; i < dof_counter; ++i) {
+        auto t_pos = col_ptr(i);
+        for(const auto& j : adjacency[idx_rcm(i)]) row_idx(t_pos++) = idx_sorted(j);
+        std::sort(row_idx.begin() + col_ptr(i), row_idx.begin() + col_ptr(i + 1));
+    }
+
     // ASSIGN NEW LABELS TO ACTIVE NODES
     auto& t_node_pond = node_pond.get();
     suanpan_for_each(t_node_pond.cbegin(), t_node_pond.cend(), [&](const shared_ptr<Node>& t_node) { t_node->set_reordered_dof(idx_sorted(t_node->get_original_dof())); });
 
+    // RESTORE NODAL STATUS WITH NEW LABELS
+    if(!t_status.empty()) {
+        vector<vec> t_global(3, vec(dof_counter, fill::zeros));
+        for(const auto& t_node : t_node_pond) {
+            const auto t_found = t_status.find(t_node->get_tag());
+            if(t_found == t_status.end()) continue;
+            auto& t_dof = t_node->get_reordered_dof();
+            for(size_t I = 0; I < t_global.size(); ++I)
+                if(t_found->second[I].n_elem == t_dof.n_elem) t_global[I](t_dof) = t_found->second[I];
+        }
+        const auto t_restore = [&](Col<double>& C, Col<double>& T, Col<double>& D, const vec& V) {
+            if(C.is_empty()) return;
+            T = C = V;
+            D.zeros(V.n_elem);
+        };
+        t_restore(get_current_displacement(factory), get_trial_displacement(factory), get_incre_displacement(factory), t_global[0]);
+        t_restore(get_current_velocity(factory), get_trial_velocity(factory), get_incre_velocity(factory), t_global[1]);
+        t_restore(get_current_acceleration(factory), get_trial_acceleration(factory), get_incre_acceleration(factory), t_global[2]);
+    }
+
     // INITIALIZE DERIVED ELEMENTS
     auto& t_element_pond = element_pond.get();
     suanpan_for_each(t_element_pond.cbegin(), t_element_pond.cend(), [&](const shared_ptr<Element>& t_element) {
@@ -570,13 +669,50 @@ int Domain::initialize() {
 
     factory->set_bandwidth(unsigned(low_bw), unsigned(-up_bw));
 
+    factory->set_sparse_pattern(col_ptr, row_idx);
+
     auto code = 0;
-    suanpan_for_each(step_pond.cbegin(), step_pond.cend(), [&](const std::pair<unsigned, shared_ptr<Step>>& t_step) {
+    for(const auto& t_step : step_pond) {
         t_step.second->set_domain(shared_from_this());
         code += t_step.second->initialize();
-    });
+    }
     if(code != 0) return -1;
 
+    // CACHE STORAGE OFFSETS OF ELEMENT MATRICES FOR CURRENT STORAGE SCHEME
+    scatter_map.clear();
+    auto& t_stiffness = factory->get_stiffness();
+    if(t_stiffness != nullptr) {
+        scatter_map.reserve(t_element_pond.size());
+        for(const auto& t_element : t_element_pond) {
+            auto& t_encoding = t_element->get_dof_encoding();
+            umat t_map(t_encoding.n_elem * t_encoding.n_elem, 2);
+            uword t_size = 0;
+            for(uword i = 0; i < t_encoding.n_elem; ++i)
+                for(uword j = 0; j < t_encoding.n_elem; ++j) {
+                    const auto t_offset = t_stiffness->offset(t_encoding(j), t_encoding(i));
+                    if(t_offset == t_stiffness->n_elem) continue;
+                    t_map(t_size, 0) = j + i * t_encoding.n_elem;
+                    t_map(t_size++, 1) = t_offset;
+                }
+            scatter_map.emplace_back(t_map.head_rows(t_size));
+        }
+    }
+
+    // GLOBAL MASS AND DAMPING ARE ONLY REASSEMBLED IF SOME ELEMENT CHANGES THEM
+    constant_mass = std::all_of(t_element_pond.cbegin(), t_element_pond.cend(), [](const shared_ptr<Element>& t_element) { return t_element->is_mass_constant(); });
+    constant_damping = std::all_of(t_element_pond.cbegin(), t_element_pond.cend(), [](const shared_ptr<Element>& t_element) { return t_element->is_damping_constant(); });
+    factory->set_mass_assembled(false);
+    factory->set_damping_assembled(false);
+
+    // RESOLVE RECORDED OBJECTS AND OPEN FILES OF STREAMING RECORDERS
+    for(const auto& I : recorder_pond.get()) I->initialize(shared_from_this());
+
+    // RESUME FROM CHECKPOINT
+    if(restart != nullptr) {
+        if(restart->load() != 0) return -1;
+        restart = nullptr;
+    }
+
     updated = true;
 
     return 0;
@@ -611,8 +747,12 @@ int Domain::process_criterion() {
 }
 
 void Domain::record() {
+    PhaseTimer T(ProfilePhase::RECORD);
+
     for(const auto& I : recorder_pond.get())
         if(I->is_active()) I->record(shared_from_this());
+
+    if(checkpoint != nullptr && ++checkpoint_counter % checkpoint_interval == 0) checkpoint->save();
 }
 
 void Domain::enable_all() {
@@ -639,28 +779,97 @@ void Domain::summary() const {
 
 void Domain::assemble_resistance() const {
     get_trial_resistance(factory).zeros();
-    for(const auto& I : element_pond.get()) factory->assemble_resistance(I->get_resistance(), I->get_dof_encoding());
+    auto& t_element_pool = element_pond.get();
+    for(const auto& I : color_map)
+        parallel_reduce(I.size(), [&](const size_t& J) {
+            auto& t_element = t_element_pool[I[J]];
+            factory->assemble_resistance(t_element->get_resistance(), t_element->get_dof_encoding());
+            return 0;
+        });
     factory->set_sushi(factory->get_trial_resistance());
 }
 
 void Domain::assemble_mass() const {
+    if(constant_mass && factory->is_mass_assembled()) return;
     factory->clear_mass();
-    for(const auto& I : element_pond.get()) factory->assemble_mass(I->get_mass(), I->get_dof_encoding());
+    auto& t_element_pool = element_pond.get();
+    for(const auto& I : color_map)
+        parallel_reduce(I.size(), [&](const size_t& J) {
+            auto& t_element = t_element_pool[I[J]];
+            scatter_map.empty() ? factory->assemble_mass(t_element->get_mass(), t_element->get_dof_encoding()) : factory->scatter_mass(t_element->get_mass(), scatter_map[I[J]]);
+            return 0;
+        });
+    factory->set_mass_assembled(true);
 }
 
 void Domain::assemble_initial_stiffness() const {
     factory->clear_stiffness();
-    for(const auto& I : element_pond.get()) factory->assemble_stiffness(I->get_initial_stiffness(), I->get_dof_encoding());
+    auto& t_element_pool = element_pond.get();
+    for(const auto& I : color_map)
+        parallel_reduce(I.size(), [&](const size_t& J) {
+            auto& t_element = t_element_pool[I[J]];
+            scatter_map.empty() ? factory->assemble_stiffness(t_element->get_initial_stiffness(), t_element->get_dof_encoding()) : factory->scatter_stiffness(t_element->get_initial_stiffness(), scatter_map[I[J]]);
+            return 0;
+        });
 }
 
 void Domain::assemble_stiffness() const {
     factory->clear_stiffness();
-    for(const auto& I : element_pond.get()) factory->assemble_stiffness(I->get_stiffness(), I->get_dof_encoding());
+    auto& t_element_pool = element_pond.get();
+    for(const auto& I : color_map)
+        parallel_reduce(I.size(), [&](const size_t& J) {
+            auto& t_element = t_element_pool[I[J]];
+            scatter_map.empty() ? factory->assemble_stiffness(t_element->get_stiffness(), t_element->get_dof_encoding()) : factory->scatter_stiffness(t_element->get_stiffness(), scatter_map[I[J]]);
+            return 0;
+        });
+}
+
+void Domain::assemble_geometry() const {
+    factory->clear_geometry();
+    auto& t_element_pool = element_pond.get();
+    for(const auto& I : color_map)
+        parallel_reduce(I.size(), [&](const size_t& J) {
+            auto& t_element = t_element_pool[I[J]];
+            scatter_map.empty() ? factory->assemble_geometry(t_element->get_geometry(), t_element->get_dof_encoding()) : factory->scatter_geometry(t_element->get_geometry(), scatter_map[I[J]]);
+            return 0;
+        });
 }
 
 void Domain::assemble_damping() const {
+    if(constant_damping && factory->is_damping_assembled()) return;
     factory->clear_damping();
-    for(const auto& I : element_pond.get()) factory->assemble_damping(I->get_damping(), I->get_dof_encoding());
+    auto& t_element_pool = element_pond.get();
+    for(const auto& I : color_map)
+        parallel_reduce(I.size(), [&](const size_t& J) {
+            auto& t_element = t_element_pool[I[J]];
+            scatter_map.empty() ? factory->assemble_damping(t_element->get_damping(), t_element->get_dof_encoding()) : factory->scatter_damping(t_element->get_damping(), scatter_map[I[J]]);
+            return 0;
+        });
+    factory->set_damping_assembled(true);
+}
+
+void Domain::assemble_lumped_mass(const LumpingScheme& S) const {
+    factory->clear_mass();
+    auto& t_element_pool = element_pond.get();
+    for(const auto& I : color_map)
+        parallel_reduce(I.size(), [&](const size_t& J) {
+            auto& t_element = t_element_pool[I[J]];
+            const auto t_mass = t_element->get_lumped_mass(S);
+            if(!t_mass.is_empty()) factory->assemble_mass(mat(diagmat(t_mass)), t_element->get_dof_encoding());
+            return 0;
+        });
+}
+
+void Domain::assemble_lumped_damping() const {
+    factory->clear_damping();
+    auto& t_element_pool = element_pond.get();
+    for(const auto& I : color_map)
+        parallel_reduce(I.size(), [&](const size_t& J) {
+            auto& t_element = t_element_pool[I[J]];
+            auto& t_damping = t_element->get_damping();
+            if(!t_damping.is_empty()) factory->assemble_damping(mat(diagmat(sum(t_damping, 1))), t_element->get_dof_encoding());
+            return 0;
+        });
 }
 
 void Domain::erase_machine_error() const {
@@ -669,104 +878,41 @@ void Domain::erase_machine_error() const {
 }
 
 int Domain::update_trial_status() const {
-    const auto& analysis_type = factory->get_analysis_type();
-
-    auto& trial_dsp = factory->get_trial_displacement();
-    auto& trial_vel = factory->get_trial_velocity();
-    auto& trial_acc = factory->get_trial_acceleration();
-    auto& trial_res = factory->get_trial_resistance();
-
-    auto& t_node_pool = node_pond.get();
+    // nodes are views into the global vectors, only elements need to be updated
     auto& t_element_pool = element_pond.get();
 
-    if(analysis_type == AnalysisType::STATICS)
-        suanpan_for_each(t_node_pool.cbegin(), t_node_pool.cend(), [&](const shared_ptr<Node>& t_node) {
-            t_node->update_trial_status(trial_dsp);
-            t_node->update_trial_resistance(trial_res);
-        });
-    else if(analysis_type == AnalysisType::DYNAMICS)
-        suanpan_for_each(t_node_pool.cbegin(), t_node_pool.cend(), [&](const shared_ptr<Node>& t_node) {
-            t_node->update_trial_status(trial_dsp, trial_vel, trial_acc);
-            t_node->update_trial_resistance(trial_res);
-        });
-
-    auto code = 0;
-
-    suanpan_for_each(t_element_pool.cbegin(), t_element_pool.cend(), [&](const shared_ptr<Element>& t_element) { code += t_element->update_status(); });
-
-    return code;
+    return parallel_reduce(t_element_pool.size(), [&](const size_t& I) { return update_element(*this, t_element_pool[I]); });
 }
 
 int Domain::update_incre_status() const {
-    const auto& analysis_type = factory->get_analysis_type();
-
-    auto& incre_dsp = factory->get_incre_displacement();
-    auto& incre_vel = factory->get_incre_velocity();
-    auto& incre_acc = factory->get_incre_acceleration();
-    auto& incre_res = factory->get_incre_resistance();
-
-    auto& t_node_pool = node_pond.get();
+    // nodes are views into the global vectors, only elements need to be updated
     auto& t_element_pool = element_pond.get();
 
-    if(analysis_type == AnalysisType::STATICS)
-        suanpan_for_each(t_node_pool.cbegin(), t_node_pool.cend(), [&](const shared_ptr<Node>& t_node) {
-            t_node->update_incre_status(incre_dsp);
-            t_node->update_incre_resistance(incre_res);
-        });
-    else if(analysis_type == AnalysisType::DYNAMICS)
-        suanpan_for_each(t_node_pool.cbegin(), t_node_pool.cend(), [&](const shared_ptr<Node>& t_node) {
-            t_node->update_incre_status(incre_dsp, incre_vel, incre_acc);
-            t_node->update_incre_resistance(incre_res);
-        });
-
-    auto code = 0;
-
-    suanpan_for_each(t_element_pool.cbegin(), t_element_pool.cend(), [&](const shared_ptr<Element>& t_element) { code += t_element->update_status(); });
-
-    return code;
+    return parallel_reduce(t_element_pool.size(), [&](const size_t& I) { return update_element(*this, t_element_pool[I]); });
 }
 
 int Domain::update_current_status() const {
     const auto& analysis_type = factory->get_analysis_type();
 
-    vec c_g_dsp(factory->get_size(), fill::zeros);
-    vec c_g_vel(factory->get_size(), fill::zeros);
-    vec c_g_acc(factory->get_size(), fill::zeros);
-
-    if(analysis_type == AnalysisType::STATICS) {
-        for(const auto& I : node_pond.get()) {
-            auto& t_dof = I->get_reordered_dof();
-            auto& current_dsp = I->get_current_displacement();
-            for(auto J = 0; J < t_dof.size(); ++J) c_g_dsp(t_dof(J)) = current_dsp(J);
-        }
-        factory->update_current_displacement(c_g_dsp);
-    } else if(analysis_type == AnalysisType::DYNAMICS) {
-        for(const auto& I : node_pond.get()) {
-            auto& t_dof = I->get_reordered_dof();
-            auto& current_dsp = I->get_current_displacement();
-            auto& current_vel = I->get_current_velocity();
-            auto& current_acc = I->get_current_acceleration();
-            for(auto J = 0; J < t_dof.size(); ++J) {
-                c_g_dsp(t_dof(J)) = current_dsp(J);
-                c_g_vel(t_dof(J)) = current_vel(J);
-                c_g_acc(t_dof(J)) = current_acc(J);
-            }
-        }
-        factory->update_current_displacement(c_g_dsp);
-        factory->update_current_velocity(c_g_vel);
-        factory->update_current_acceleration(c_g_acc);
+    // nodes are views into the global vectors, trial status restarts from the committed one
+    if(analysis_type == AnalysisType::STATICS || analysis_type == AnalysisType::BUCKLE)
+        factory->update_current_displacement(factory->get_current_displacement());
+    else if(analysis_type == AnalysisType::DYNAMICS) {
+        factory->update_current_displacement(factory->get_current_displacement());
+        factory->update_current_velocity(factory->get_current_velocity());
+        factory->update_current_acceleration(factory->get_current_acceleration());
     }
 
     return 0;
 }
 
 void Domain::commit_status() const {
+    PhaseTimer T(ProfilePhase::COMMIT);
+
     factory->commit_status();
 
-    auto& t_node_pool = node_pond.get();
     auto& t_element_pool = element_pond.get();
 
-    suanpan_for_each(t_node_pool.cbegin(), t_node_pool.cend(), [](const shared_ptr<Node>& t_node) { t_node->commit_status(); });
     suanpan_for_each(t_element_pool.cbegin(), t_element_pool.cend(), [](const shared_ptr<Element>& t_element) {
         t_element->Element::commit_status();
         t_element->commit_status();
@@ -776,10 +922,8 @@ void Domain::commit_status() const {
 void Domain::clear_status() const {
     factory->clear_status();
 
-    auto& t_node_pool = node_pond.get();
     auto& t_element_pool = element_pond.get();
 
-    suanpan_for_each(t_node_pool.cbegin(), t_node_pool.cend(), [](const shared_ptr<Node>& t_node) { t_node->clear_status(); });
     suanpan_for_each(t_element_pool.cbegin(), t_element_pool.cend(), [](const shared_ptr<Element>& t_element) {
         t_element->Element::clear_status();
         t_element->clear_status();
@@ -789,10 +933,8 @@ void Domain::clear_status() const {
 void Domain::reset_status() const {
     factory->reset_status();
 
-    auto& t_node_pool = node_pond.get();
     auto& t_element_pool = element_pond.get();
 
-    suanpan_for_each(t_node_pool.cbegin(), t_node_pool.cend(), [](const shared_ptr<Node>& t_node) { t_node->reset_status(); });
     suanpan_for_each(t_element_pool.cbegin(), t_element_pool.cend(), [](const shared_ptr<Element>& t_element) {
         t_element->Element::reset_status();
         t_element->reset_status();
@@ -64,6 +64,19 @@ class Domain : public DomainBase, public std::enable_shared_from_this<Domain> {
     unordered_set<unsigned> constrained_dofs; /**< data storage */
     unordered_set<unsigned> loaded_dofs;      /**< data storage */
     unordered_set<unsigned> restrained_dofs;  /**< data storage */
+
+    vector<vector<unsigned>> color_map; /**< element batches without shared dof */
+    vector<umat> scatter_map;           /**< storage offsets of element matrices */
+
+    bool constant_mass = false;    /**< no element changes its mass during analysis */
+    bool constant_damping = false; /**< no element changes its damping during analysis */
+
+    double step_start_time = 0.; /**< time at which current step starts */
+
+    shared_ptr<Database> checkpoint;  /**< database to write checkpoints */
+    shared_ptr<Database> restart;     /**< database to resume analysis from */
+    unsigned checkpoint_interval = 1; /**< number of converged substeps between checkpoints */
+    unsigned checkpoint_counter = 0;
 public:
     explicit Domain(const unsigned& = 0);
 
@@ -87,6 +100,9 @@ public:
     bool insert(const shared_ptr<Solver>&) override;
     bool insert(const shared_ptr<Step>&) override;
 
+    bool insert(const vector<shared_ptr<Element>>&) override;
+    bool insert(const vector<shared_ptr<Node>>&) override;
+
     bool erase_amplitude(const unsigned&) override;
     bool erase_constraint(const unsigned&) override;
     bool erase_converger(const unsigned&) override;
@@ -228,6 +244,11 @@ public:
     const shared_ptr<Integrator>& get_current_integrator() const override;
     const shared_ptr<Solver>& get_current_solver() const override;
 
+    const double& get_step_start_time() const override;
+
+    void set_checkpoint(const shared_ptr<Database>&, const unsigned&) override;
+    void set_restart(const shared_ptr<Database>&) override;
+
     bool insert_loaded_dof(const unsigned&) override;
     bool insert_restrained_dof(const unsigned&) override;
     bool insert_constrained_dof(const unsigned&) override;
@@ -255,8 +276,12 @@ public:
     void assemble_mass() const override;
     void assemble_initial_stiffness() const override;
     void assemble_stiffness() const override;
+    void assemble_geometry() const override;
     void assemble_damping() const override;
 
+    void assemble_lumped_mass(const LumpingScheme&) const override;
+    void assemble_lumped_damping() const override;
+
     void erase_machine_error() const override;
 
     int update_current_status() const override;
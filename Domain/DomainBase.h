@@ -43,7 +43,9 @@ class Amplitude;
 class Constraint;
 class Converger;
 class Criterion;
+class Database;
 class Element;
+enum class LumpingScheme;
 class ExternalModule;
 class Integrator;
 class Load;
@@ -95,6 +97,9 @@ public:
     virtual bool insert(const shared_ptr<Solver>&) = 0;
     virtual bool insert(const shared_ptr<Step>&) = 0;
 
+    virtual bool insert(const vector<shared_ptr<Element>>&) = 0;
+    virtual bool insert(const vector<shared_ptr<Node>>&) = 0;
+
     virtual bool erase_amplitude(const unsigned&) = 0;
     virtual bool erase_constraint(const unsigned&) = 0;
     virtual bool erase_converger(const unsigned&) = 0;
@@ -222,6 +227,11 @@ public:
     virtual const shared_ptr<Integrator>& get_current_integrator() const = 0;
     virtual const shared_ptr<Solver>& get_current_solver() const = 0;
 
+    virtual const double& get_step_start_time() const = 0;
+
+    virtual void set_checkpoint(const shared_ptr<Database>&, const unsigned&) = 0;
+    virtual void set_restart(const shared_ptr<Database>&) = 0;
+
     virtual bool insert_loaded_dof(const unsigned&) = 0;
     virtual bool insert_restrained_dof(const unsigned&) = 0;
     virtual bool insert_constrained_dof(const unsigned&) = 0;
@@ -246,6 +256,10 @@ public:
     virtual void assemble_initial_stiffness() const = 0;
     virtual void assemble_mass() const = 0;
     virtual void assemble_stiffness() const = 0;
+    virtual void assemble_geometry() const = 0;
+
+    virtual void assemble_lumped_mass(const LumpingScheme&) const = 0;
+    virtual void assemble_lumped_damping() const = 0;
 
     virtual void erase_machine_error() const = 0;
 
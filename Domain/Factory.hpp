@@ -18,8 +18,8 @@
 #include <Domain/MetaMat/MetaMat>
 #include <suanPan.h>
 
-enum class AnalysisType { NONE, DISP, EIGEN, STATICS, DYNAMICS };
-enum class StorageScheme { FULL, BAND, BANDSYMM, SYMMPACK };
+enum class AnalysisType { NONE, DISP, EIGEN, BUCKLE, STATICS, DYNAMICS };
+enum class StorageScheme { FULL, BAND, BANDSYMM, SYMMPACK, SPARSE, DIAGONAL };
 
 template <typename T> class Factory final {
     unsigned n_size = 0;               /**< number of degrees of freedom */
@@ -28,9 +28,14 @@ template <typename T> class Factory final {
     unsigned n_sfbw = n_lobw + n_upbw; /**< matrix storage offset */
     unsigned n_rfld = 0;               /**< reference load size */
 
+    uvec sp_col_ptr; /**< column pointers of sparse pattern */
+    uvec sp_row_idx; /**< row indices of sparse pattern */
+
     AnalysisType analysis_type = AnalysisType::NONE;  /**< type of analysis */
     StorageScheme storage_type = StorageScheme::FULL; /**< type of analysis */
 
+    IterativeSetting<T> iterative_setting; /**< iterative solver of sparse storage */
+
     T error = 0.; /**< error produced by certain solvers */
 
     Col<T> ninja; /**< the result from A*X=B */
@@ -82,6 +87,10 @@ template <typename T> class Factory final {
     shared_ptr<MetaMat<T>> global_mass = nullptr;      /**< global mass matrix */
     shared_ptr<MetaMat<T>> global_damping = nullptr;   /**< global damping matrix */
     shared_ptr<MetaMat<T>> global_stiffness = nullptr; /**< global stiffness matrix */
+    shared_ptr<MetaMat<T>> global_geometry = nullptr;  /**< global geometry matrix */
+
+    bool mass_assembled = false;    /**< global mass matrix holds assembled values */
+    bool damping_assembled = false; /**< global damping matrix holds assembled values */
 
     Col<T> eigenvalue; /**< eigenvalues */
 
@@ -103,6 +112,12 @@ public:
     void set_bandwidth(const unsigned&, const unsigned&);
     void get_bandwidth(unsigned&, unsigned&) const;
 
+    void set_sparse_pattern(const uvec&, const uvec&);
+    void get_sparse_pattern(uvec&, uvec&) const;
+
+    void set_iterative_setting(const IterativeSetting<T>&);
+    const IterativeSetting<T>& get_iterative_setting() const;
+
     void set_reference_size(const unsigned&);
     const unsigned& get_reference_size() const;
 
@@ -125,6 +140,7 @@ public:
     void initialize_mass();
     void initialize_damping();
     void initialize_stiffness();
+    void initialize_geometry();
     void initialize_eigen();
 
     /*************************SETTER*************************/
@@ -177,6 +193,7 @@ public:
     void set_mass(const shared_ptr<MetaMat<T>>&);
     void set_damping(const shared_ptr<MetaMat<T>>&);
     void set_stiffness(const shared_ptr<MetaMat<T>>&);
+    void set_geometry(const shared_ptr<MetaMat<T>>&);
 
     void set_eigenvalue(const Col<T>&);
     void set_eigenvector(const Mat<T>&);
@@ -231,6 +248,7 @@ public:
     const shared_ptr<MetaMat<T>>& get_mass() const;
     const shared_ptr<MetaMat<T>>& get_damping() const;
     const shared_ptr<MetaMat<T>>& get_stiffness() const;
+    const shared_ptr<MetaMat<T>>& get_geometry() const;
 
     const Col<T>& get_eigenvalue() const;
     const Mat<T>& get_eigenvector() const;
@@ -317,6 +335,7 @@ public:
     template <typename T1> friend MetaMat<T1>& get_mass(const shared_ptr<Factory<T1>>&);
     template <typename T1> friend MetaMat<T1>& get_damping(const shared_ptr<Factory<T1>>&);
     template <typename T1> friend MetaMat<T1>& get_stiffness(const shared_ptr<Factory<T1>>&);
+    template <typename T1> friend MetaMat<T1>& get_geometry(const shared_ptr<Factory<T1>>&);
 
     template <typename T1> friend Col<T1>& get_eigenvalue(const shared_ptr<Factory<T1>>&);
     template <typename T1> friend Mat<T1>& get_eigenvector(const shared_ptr<Factory<T1>>&);
@@ -371,6 +390,15 @@ public:
     void clear_mass();
     void clear_damping();
     void clear_stiffness();
+    void clear_geometry();
+
+    /*************************CACHE*************************/
+
+    void set_mass_assembled(const bool&);
+    void set_damping_assembled(const bool&);
+
+    bool is_mass_assembled() const;
+    bool is_damping_assembled() const;
 
     /*************************ASSEMBLER*************************/
 
@@ -378,6 +406,12 @@ public:
     void assemble_mass(const Mat<T>&, const uvec&);
     void assemble_damping(const Mat<T>&, const uvec&);
     void assemble_stiffness(const Mat<T>&, const uvec&);
+    void assemble_geometry(const Mat<T>&, const uvec&);
+
+    void scatter_mass(const Mat<T>&, const umat&);
+    void scatter_damping(const Mat<T>&, const umat&);
+    void scatter_stiffness(const Mat<T>&, const umat&);
+    void scatter_geometry(const Mat<T>&, const umat&);
 
     /*************************UTILITY*************************/
 
@@ -436,6 +470,28 @@ template <typename T> void Factory<T>::get_bandwidth(unsigned& L, unsigned& U) c
     U = n_upbw;
 }
 
+template <typename T> void Factory<T>::set_sparse_pattern(const uvec& C, const uvec& R) {
+    if(sp_col_ptr.n_elem != C.n_elem || sp_row_idx.n_elem != R.n_elem || any(sp_col_ptr != C) || any(sp_row_idx != R)) {
+        sp_col_ptr = C;
+        sp_row_idx = R;
+        access::rw(initialized) = false;
+    }
+}
+
+template <typename T> void Factory<T>::get_sparse_pattern(uvec& C, uvec& R) const {
+    C = sp_col_ptr;
+    R = sp_row_idx;
+}
+
+template <typename T> void Factory<T>::set_iterative_setting(const IterativeSetting<T>& S) {
+    iterative_setting = S;
+    if(storage_type != StorageScheme::SPARSE || global_stiffness == nullptr) return;
+    auto t_stiffness = std::dynamic_pointer_cast<SparseMat<T>>(global_stiffness);
+    if(t_stiffness != nullptr) t_stiffness->set_iterative_setting(iterative_setting);
+}
+
+template <typename T> const IterativeSetting<T>& Factory<T>::get_iterative_setting() const { return iterative_setting; }
+
 template <typename T> void Factory<T>::set_reference_size(const unsigned& S) {
     if(n_rfld != S) {
         n_rfld = S;
@@ -465,6 +521,14 @@ template <typename T> int Factory<T>::initialize() {
         initialize_stiffness();
         initialize_eigen();
         break;
+    case AnalysisType::BUCKLE:
+        initialize_load();
+        initialize_resistance();
+        initialize_displacement();
+        initialize_stiffness();
+        initialize_geometry();
+        initialize_eigen();
+        break;
     case AnalysisType::STATICS:
         initialize_load();
         initialize_resistance();
@@ -512,24 +576,45 @@ template <typename T> void Factory<T>::initialize_settlement() {
 }
 
 template <typename T> void Factory<T>::initialize_resistance() {
+    // nodal status lives in these vectors, committed values of the same size survive re-initialization
+    if(current_resistance.n_elem == n_size) {
+        trial_resistance = current_resistance;
+        incre_resistance.zeros(n_size);
+        return;
+    }
     trial_resistance.zeros(n_size);
     incre_resistance.zeros(n_size);
     current_resistance.zeros(n_size);
 }
 
 template <typename T> void Factory<T>::initialize_displacement() {
+    if(current_displacement.n_elem == n_size) {
+        trial_displacement = current_displacement;
+        incre_displacement.zeros(n_size);
+        return;
+    }
     trial_displacement.zeros(n_size);
     incre_displacement.zeros(n_size);
     current_displacement.zeros(n_size);
 }
 
 template <typename T> void Factory<T>::initialize_velocity() {
+    if(current_velocity.n_elem == n_size) {
+        trial_velocity = current_velocity;
+        incre_velocity.zeros(n_size);
+        return;
+    }
     trial_velocity.zeros(n_size);
     incre_velocity.zeros(n_size);
     current_velocity.zeros(n_size);
 }
 
 template <typename T> void Factory<T>::initialize_acceleration() {
+    if(current_acceleration.n_elem == n_size) {
+        trial_acceleration = current_acceleration;
+        incre_acceleration.zeros(n_size);
+        return;
+    }
     trial_acceleration.zeros(n_size);
     incre_acceleration.zeros(n_size);
     current_acceleration.zeros(n_size);
@@ -542,6 +627,8 @@ template <typename T> void Factory<T>::initialize_temperature() {
 }
 
 template <typename T> void Factory<T>::initialize_mass() {
+    mass_assembled = false;
+
     switch(storage_type) {
     case StorageScheme::FULL:
         global_mass = make_shared<FullMat<T>>(n_size);
@@ -555,10 +642,18 @@ template <typename T> void Factory<T>::initialize_mass() {
     case StorageScheme::SYMMPACK:
         global_mass = make_shared<SymmPackMat<T>>(n_size);
         break;
+    case StorageScheme::SPARSE:
+        global_mass = make_shared<SparseMat<T>>(n_size, sp_col_ptr, sp_row_idx);
+        break;
+    case StorageScheme::DIAGONAL:
+        global_mass = make_shared<DiagMat<T>>(n_size);
+        break;
     }
 }
 
 template <typename T> void Factory<T>::initialize_damping() {
+    damping_assembled = false;
+
     switch(storage_type) {
     case StorageScheme::FULL:
         global_damping = make_shared<FullMat<T>>(n_size);
@@ -572,6 +667,12 @@ template <typename T> void Factory<T>::initialize_damping() {
     case StorageScheme::SYMMPACK:
         global_damping = make_shared<SymmPackMat<T>>(n_size);
         break;
+    case StorageScheme::SPARSE:
+        global_damping = make_shared<SparseMat<T>>(n_size, sp_col_ptr, sp_row_idx);
+        break;
+    case StorageScheme::DIAGONAL:
+        global_damping = make_shared<DiagMat<T>>(n_size);
+        break;
     }
 }
 
@@ -589,12 +690,45 @@ template <typename T> void Factory<T>::initialize_stiffness() {
     case StorageScheme::SYMMPACK:
         global_stiffness = make_shared<SymmPackMat<T>>(n_size);
         break;
+    case StorageScheme::SPARSE: {
+        auto t_stiffness = make_shared<SparseMat<T>>(n_size, sp_col_ptr, sp_row_idx);
+        t_stiffness->set_iterative_setting(iterative_setting);
+        global_stiffness = t_stiffness;
+        break;
+    }
+    case StorageScheme::DIAGONAL:
+        global_stiffness = make_shared<DiagMat<T>>(n_size);
+        break;
+    }
+}
+
+template <typename T> void Factory<T>::initialize_geometry() {
+    switch(storage_type) {
+    case StorageScheme::FULL:
+        global_geometry = make_shared<FullMat<T>>(n_size);
+        break;
+    case StorageScheme::BAND:
+        global_geometry = make_shared<BandMat<T>>(n_size, n_lobw, n_upbw);
+        break;
+    case StorageScheme::BANDSYMM:
+        global_geometry = make_shared<BandSymmMat<T>>(n_size, n_lobw);
+        break;
+    case StorageScheme::SYMMPACK:
+        global_geometry = make_shared<SymmPackMat<T>>(n_size);
+        break;
+    case StorageScheme::SPARSE:
+        global_geometry = make_shared<SparseMat<T>>(n_size, sp_col_ptr, sp_row_idx);
+        break;
+    case StorageScheme::DIAGONAL:
+        global_geometry = make_shared<DiagMat<T>>(n_size);
+        break;
     }
 }
 
 template <typename T> void Factory<T>::initialize_eigen() {
-    eigenvalue.zeros(n_size);
-    eigenvector.zeros(n_size, n_size);
+    // only requested modes are stored, the size is set by eigen solver
+    eigenvalue.reset();
+    eigenvector.reset();
 }
 
 template <typename T> void Factory<T>::set_ninja(const Col<T>& N) { ninja = N; }
@@ -675,12 +809,20 @@ template <typename T> void Factory<T>::set_pre_acceleration(const Col<T>& A) { p
 
 template <typename T> void Factory<T>::set_pre_temperature(const Col<T>& M) { pre_temperature = M; }
 
-template <typename T> void Factory<T>::set_mass(const shared_ptr<MetaMat<T>>& M) { global_mass = M; }
+template <typename T> void Factory<T>::set_mass(const shared_ptr<MetaMat<T>>& M) {
+    global_mass = M;
+    mass_assembled = false;
+}
 
-template <typename T> void Factory<T>::set_damping(const shared_ptr<MetaMat<T>>& C) { global_damping = C; }
+template <typename T> void Factory<T>::set_damping(const shared_ptr<MetaMat<T>>& C) {
+    global_damping = C;
+    damping_assembled = false;
+}
 
 template <typename T> void Factory<T>::set_stiffness(const shared_ptr<MetaMat<T>>& K) { global_stiffness = K; }
 
+template <typename T> void Factory<T>::set_geometry(const shared_ptr<MetaMat<T>>& G) { global_geometry = G; }
+
 template <typename T> void Factory<T>::set_eigenvalue(const Col<T>& L) { eigenvalue = L; }
 
 template <typename T> void Factory<T>::set_eigenvector(const Mat<T>& V) { eigenvector = V; }
@@ -769,6 +911,8 @@ template <typename T> const shared_ptr<MetaMat<T>>& Factory<T>::get_damping() co
 
 template <typename T> const shared_ptr<MetaMat<T>>& Factory<T>::get_stiffness() const { return global_stiffness; }
 
+template <typename T> const shared_ptr<MetaMat<T>>& Factory<T>::get_geometry() const { return global_geometry; }
+
 template <typename T> const Col<T>& Factory<T>::get_eigenvalue() const { return eigenvalue; }
 
 template <typename T> const Mat<T>& Factory<T>::get_eigenvector() const { return eigenvector; }
@@ -1180,16 +1324,33 @@ template <typename T> void Factory<T>::clear_eigen() {
 
 template <typename T> void Factory<T>::clear_mass() {
     if(global_mass != nullptr && !global_mass->is_empty()) global_mass->zeros();
+    mass_assembled = false;
 }
 
 template <typename T> void Factory<T>::clear_damping() {
     if(global_damping != nullptr && !global_damping->is_empty()) global_damping->zeros();
+    damping_assembled = false;
 }
 
 template <typename T> void Factory<T>::clear_stiffness() {
     if(global_stiffness != nullptr && !global_stiffness->is_empty()) global_stiffness->zeros();
 }
 
+template <typename T> void Factory<T>::clear_geometry() {
+    if(global_geometry != nullptr && !global_geometry->is_empty()) global_geometry->zeros();
+}
+
+template <typename T> void Factory<T>::set_mass_assembled(const bool& B) { mass_assembled = B; }
+
+template <typename T> void Factory<T>::set_damping_assembled(const bool& B) { damping_assembled = B; }
+
+/**
+ * \brief The cached global mass is valid only if it is assembled and not overwritten by factorization.
+ */
+template <typename T> bool Factory<T>::is_mass_assembled() const { return mass_assembled && global_mass != nullptr && !global_mass->factored; }
+
+template <typename T> bool Factory<T>::is_damping_assembled() const { return damping_assembled && global_damping != nullptr && !global_damping->factored; }
+
 template <typename T> void Factory<T>::assemble_resistance(const Mat<T>& ER, const uvec& EI) {
     if(ER.is_empty()) return;
     for(unsigned I = 0; I < EI.n_elem; ++I) trial_resistance(EI(I)) += ER(I);
@@ -1213,6 +1374,53 @@ template <typename T> void Factory<T>::assemble_stiffness(const Mat<T>& EK, cons
         for(unsigned J = 0; J < EI.n_elem; ++J) global_stiffness->at(EI(J), EI(I)) += EK(J, I);
 }
 
+template <typename T> void Factory<T>::assemble_geometry(const Mat<T>& EG, const uvec& EI) {
+    if(EG.is_empty()) return;
+    for(unsigned I = 0; I < EI.n_elem; ++I)
+        for(unsigned J = 0; J < EI.n_elem; ++J) global_geometry->at(EI(J), EI(I)) += EG(J, I);
+}
+
+/**
+ * \brief Adds element matrix to global matrix using precomputed storage offsets.
+ * The first column of `EO` holds positions in `EM`, the second column holds
+ * the corresponding positions in the memory of global matrix.
+ */
+template <typename T> void Factory<T>::scatter_mass(const Mat<T>& EM, const umat& EO) {
+    if(EM.is_empty()) return;
+    const auto t_local = EO.colptr(0);
+    const auto t_global = EO.colptr(1);
+    const auto t_source = EM.memptr();
+    const auto t_target = global_mass->memptr();
+    for(uword I = 0; I < EO.n_rows; ++I) t_target[t_global[I]] += t_source[t_local[I]];
+}
+
+template <typename T> void Factory<T>::scatter_damping(const Mat<T>& EC, const umat& EO) {
+    if(EC.is_empty()) return;
+    const auto t_local = EO.colptr(0);
+    const auto t_global = EO.colptr(1);
+    const auto t_source = EC.memptr();
+    const auto t_target = global_damping->memptr();
+    for(uword I = 0; I < EO.n_rows; ++I) t_target[t_global[I]] += t_source[t_local[I]];
+}
+
+template <typename T> void Factory<T>::scatter_stiffness(const Mat<T>& EK, const umat& EO) {
+    if(EK.is_empty()) return;
+    const auto t_local = EO.colptr(0);
+    const auto t_global = EO.colptr(1);
+    const auto t_source = EK.memptr();
+    const auto t_target = global_stiffness->memptr();
+    for(uword I = 0; I < EO.n_rows; ++I) t_target[t_global[I]] += t_source[t_local[I]];
+}
+
+template <typename T> void Factory<T>::scatter_geometry(const Mat<T>& EG, const umat& EO) {
+    if(EG.is_empty()) return;
+    const auto t_local = EO.colptr(0);
+    const auto t_global = EO.colptr(1);
+    const auto t_source = EG.memptr();
+    const auto t_target = global_geometry->memptr();
+    for(uword I = 0; I < EO.n_rows; ++I) t_target[t_global[I]] += t_source[t_local[I]];
+}
+
 template <typename T> void Factory<T>::print() const { suanpan_info("This is a Factory object with size of %u.\n", n_size); }
 
 template <typename T> Col<T>& get_ninja(const shared_ptr<Factory<T>>& W) { return W->ninja; }
@@ -1299,6 +1507,8 @@ template <typename T> MetaMat<T>& get_damping(const shared_ptr<Factory<T>>& W) {
 
 template <typename T> MetaMat<T>& get_stiffness(const shared_ptr<Factory<T>>& W) { return *W->global_stiffness; }
 
+template <typename T> MetaMat<T>& get_geometry(const shared_ptr<Factory<T>>& W) { return *W->global_geometry; }
+
 template <typename T> Col<T>& get_eigenvalue(const shared_ptr<Factory<T>>& W) { return W->eigenvalue; }
 
 template <typename T> Mat<T>& get_eigenvector(const shared_ptr<Factory<T>>& W) { return W->eigenvector; }
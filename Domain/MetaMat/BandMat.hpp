@@ -16,7 +16,7 @@
 #include <Toolbox/debug.h>
 
 template <typename T> class BandMat : public MetaMat<T> {
-    static T bin;
+    static thread_local T bin;
     using MetaMat<T>::i;
     using MetaMat<T>::inv;
 
@@ -42,6 +42,8 @@ public:
     const T& operator()(const uword&, const uword&) const override;
     T& at(const uword&, const uword&) override;
 
+    uword offset(const uword&, const uword&) const override;
+
     Mat<T> operator*(const Mat<T>&)override;
 
     int solve(Mat<T>&, const Mat<T>&) override;
@@ -54,7 +56,7 @@ template <typename T> struct is_Band { static const bool value = false; };
 
 template <typename T> struct is_Band<BandMat<T>> { static const bool value = true; };
 
-template <typename T> T BandMat<T>::bin = 0.;
+template <typename T> thread_local T BandMat<T>::bin = 0.;
 
 template <typename T>
 BandMat<T>::BandMat()
@@ -89,31 +91,36 @@ template <typename T> T& BandMat<T>::at(const uword& in_row, const uword& in_col
     return access::rw(memory[in_row - in_col + shift_bw + in_col * n_rows]);
 }
 
+template <typename T> uword BandMat<T>::offset(const uword& in_row, const uword& in_col) const {
+    const auto n_bw = int(in_row) - int(in_col);
+    if(n_bw > int(low_bw) || n_bw < -int(up_bw)) return n_elem;
+    return in_row - in_col + shift_bw + in_col * n_rows;
+}
+
 template <typename T> Mat<T> BandMat<T>::operator*(const Mat<T>& X) {
-    if(X.is_colvec()) {
-        auto Y = X;
-
-        int M = n_cols;
-        int N = n_cols;
-        int KL = low_bw;
-        int KU = up_bw;
-        T ALPHA = 1.;
-        int LDA = n_rows;
-        auto INC = 1;
-        T BETA = 0.;
+    auto Y = X;
 
+    int M = n_cols;
+    int N = n_cols;
+    int KL = low_bw;
+    int KU = up_bw;
+    T ALPHA = 1.;
+    int LDA = n_rows;
+    auto INC = 1;
+    T BETA = 0.;
+
+    // the first low_bw rows are reserved for factorization
+    // multiple columns are multiplied one by one
+    for(uword I = 0; I < X.n_cols; ++I)
         if(std::is_same<T, float>::value) {
             using E = float;
-            arma_fortran(arma_sgbmv)(&TRAN, &M, &N, &KL, &KU, (E*)&ALPHA, (E*)this->memptr(), &LDA, (E*)X.memptr(), &INC, (E*)&BETA, (E*)Y.memptr(), &INC);
+            arma_fortran(arma_sgbmv)(&TRAN, &M, &N, &KL, &KU, (E*)&ALPHA, (E*)(this->memptr() + low_bw), &LDA, (E*)X.colptr(I), &INC, (E*)&BETA, (E*)Y.colptr(I), &INC);
         } else if(std::is_same<T, double>::value) {
             using E = double;
-            arma_fortran(arma_dgbmv)(&TRAN, &M, &N, &KL, &KU, (E*)&ALPHA, (E*)this->memptr(), &LDA, (E*)X.memptr(), &INC, (E*)&BETA, (E*)Y.memptr(), &INC);
+            arma_fortran(arma_dgbmv)(&TRAN, &M, &N, &KL, &KU, (E*)&ALPHA, (E*)(this->memptr() + low_bw), &LDA, (E*)X.colptr(I), &INC, (E*)&BETA, (E*)Y.colptr(I), &INC);
         }
 
-        return Y;
-    }
-
-    return X;
+    return Y;
 }
 
 template <typename T> int BandMat<T>::solve(Mat<T>& X, const Mat<T>& B) {
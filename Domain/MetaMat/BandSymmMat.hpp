@@ -16,7 +16,7 @@
 #include <Toolbox/debug.h>
 
 template <typename T> class BandSymmMat : public MetaMat<T> {
-    static T bin;
+    static thread_local T bin;
     using MetaMat<T>::i;
     using MetaMat<T>::inv;
 
@@ -39,6 +39,8 @@ public:
     const T& operator()(const uword&, const uword&) const override;
     T& at(const uword&, const uword&) override;
 
+    uword offset(const uword&, const uword&) const override;
+
     Mat<T> operator*(const Mat<T>&)override;
 
     int solve(Mat<T>&, const Mat<T>&) override;
@@ -51,7 +53,7 @@ template <typename T> struct is_BandSymm { static const bool value = false; };
 
 template <typename T> struct is_BandSymm<BandSymmMat<T>> { static const bool value = true; };
 
-template <typename T> T BandSymmMat<T>::bin = 0.;
+template <typename T> thread_local T BandSymmMat<T>::bin = 0.;
 
 template <typename T>
 BandSymmMat<T>::BandSymmMat()
@@ -80,29 +82,32 @@ template <typename T> T& BandSymmMat<T>::at(const uword& in_row, const uword& in
     return access::rw(memory[in_row - in_col + in_col * n_rows]);
 }
 
-template <typename T> Mat<T> BandSymmMat<T>::operator*(const Mat<T>& X) {
-    if(X.is_colvec()) {
-        auto Y = X;
+template <typename T> uword BandSymmMat<T>::offset(const uword& in_row, const uword& in_col) const {
+    if(in_row < in_col || in_row - in_col > bw) return n_elem;
+    return in_row - in_col + in_col * n_rows;
+}
 
-        int N = n_cols;
-        int K = bw;
-        T ALPHA = 1.;
-        int LDA = n_rows;
-        auto INC = 1;
-        T BETA = 0.;
+template <typename T> Mat<T> BandSymmMat<T>::operator*(const Mat<T>& X) {
+    auto Y = X;
 
+    int N = n_cols;
+    int K = bw;
+    T ALPHA = 1.;
+    int LDA = n_rows;
+    auto INC = 1;
+    T BETA = 0.;
+
+    // multiple columns are multiplied one by one
+    for(uword I = 0; I < X.n_cols; ++I)
         if(std::is_same<T, float>::value) {
             using E = float;
-            arma_fortran(arma_ssbmv)(&UPLO, &N, &K, (E*)&ALPHA, (E*)this->memptr(), &LDA, (E*)X.memptr(), &INC, (E*)&BETA, (E*)Y.memptr(), &INC);
+            arma_fortran(arma_ssbmv)(&UPLO, &N, &K, (E*)&ALPHA, (E*)this->memptr(), &LDA, (E*)X.colptr(I), &INC, (E*)&BETA, (E*)Y.colptr(I), &INC);
         } else if(std::is_same<T, double>::value) {
             using E = double;
-            arma_fortran(arma_dsbmv)(&UPLO, &N, &K, (E*)&ALPHA, (E*)this->memptr(), &LDA, (E*)X.memptr(), &INC, (E*)&BETA, (E*)Y.memptr(), &INC);
+            arma_fortran(arma_dsbmv)(&UPLO, &N, &K, (E*)&ALPHA, (E*)this->memptr(), &LDA, (E*)X.colptr(I), &INC, (E*)&BETA, (E*)Y.colptr(I), &INC);
         }
 
-        return Y;
-    }
-
-    return X;
+    return Y;
 }
 
 template <typename T> int BandSymmMat<T>::solve(Mat<T>& X, const Mat<T>& B) {
@@ -0,0 +1,118 @@
+/**
+ * @class DiagMat
+ * @brief A DiagMat class that holds diagonal matrices.
+ *
+ * Only the diagonal is stored, off-diagonal entries are zero and cannot be
+ * written. The class is used for lumped mass and damping in explicit
+ * dynamic analysis, where the solution reduces to an element-wise division.
+ *
+ * @author T
+ * @date 23/10/2017
+ * @version 0.1.0
+ * @file DiagMat.hpp
+ * @addtogroup MetaMat
+ * @{
+ */
+
+#ifndef DIAGMAT_HPP
+#define DIAGMAT_HPP
+
+#include <suanPan.h>
+
+template <typename T> class DiagMat : public MetaMat<T> {
+    static thread_local T bin;
+
+public:
+    using MetaMat<T>::IPIV;
+    using MetaMat<T>::TRAN;
+    using MetaMat<T>::factored;
+    using MetaMat<T>::n_cols;
+    using MetaMat<T>::n_rows;
+    using MetaMat<T>::n_elem;
+    using MetaMat<T>::memory;
+    using MetaMat<T>::solve;
+    using MetaMat<T>::solve_trs;
+    using MetaMat<T>::factorize;
+
+    DiagMat();
+    explicit DiagMat(const unsigned&);
+
+    const T& operator()(const uword&, const uword&) const override;
+    T& at(const uword&, const uword&) override;
+
+    uword offset(const uword&, const uword&) const override;
+
+    Mat<T> operator*(const Mat<T>&)override;
+
+    int solve(Mat<T>&, const Mat<T>&) override;
+    int solve_trs(Mat<T>&, const Mat<T>&) override;
+
+    MetaMat<T> factorize() override;
+
+    MetaMat<T> i() override;
+};
+
+template <typename T> struct is_Diag { static const bool value = false; };
+
+template <typename T> struct is_Diag<DiagMat<T>> { static const bool value = true; };
+
+template <typename T> thread_local T DiagMat<T>::bin = 0.;
+
+template <typename T>
+DiagMat<T>::DiagMat()
+    : MetaMat<T>() {}
+
+template <typename T>
+DiagMat<T>::DiagMat(const unsigned& in_size)
+    : MetaMat<T>(in_size, in_size, in_size) {}
+
+template <typename T> const T& DiagMat<T>::operator()(const uword& in_row, const uword& in_col) const {
+    if(in_row != in_col) {
+        bin = 0.;
+        return bin;
+    }
+    return memory[in_row];
+}
+
+template <typename T> T& DiagMat<T>::at(const uword& in_row, const uword& in_col) {
+    if(in_row != in_col) {
+        bin = 0.;
+        return bin;
+    }
+    return access::rw(memory[in_row]);
+}
+
+template <typename T> uword DiagMat<T>::offset(const uword& in_row, const uword& in_col) const { return in_row == in_col ? in_row : n_elem; }
+
+template <typename T> Mat<T> DiagMat<T>::operator*(const Mat<T>& X) {
+    Mat<T> Y = X;
+    Y.each_col() %= Col<T>(memory, n_elem);
+    return Y;
+}
+
+template <typename T> int DiagMat<T>::solve(Mat<T>& X, const Mat<T>& B) {
+    const Col<T> t_diag(memory, n_elem);
+
+    if(any(t_diag == T(0))) {
+        suanpan_error("solve() detects zero diagonal entries, the matrix is singular.\n");
+        return -1;
+    }
+
+    X = B;
+    X.each_col() /= t_diag;
+
+    factored = true;
+
+    return 0;
+}
+
+template <typename T> int DiagMat<T>::solve_trs(Mat<T>& X, const Mat<T>& B) { return solve(X, B); }
+
+// a MetaMat returned by value cannot keep the diagonal storage, solve() divides directly instead
+template <typename T> MetaMat<T> DiagMat<T>::factorize() { throw logic_error("DiagMat does not support factorize(), use solve() instead.\n"); }
+
+template <typename T> MetaMat<T> DiagMat<T>::i() { throw logic_error("DiagMat does not support i(), use solve() instead.\n"); }
+
+#endif
+
+//! @}
@@ -0,0 +1,386 @@
+/**
+ * @brief Preconditioned Krylov subspace solvers for sparse systems.
+ *
+ * PCG is meant for symmetric positive definite systems, BiCGStab and
+ * restarted GMRES for unsymmetric ones. The system matrix is only accessed
+ * via matrix--vector products so that no factorization is stored.
+ *
+ * The preconditioners operate on the compressed column storage used by
+ * SparseMat. The incomplete factorization is ILU(0) on the given pattern,
+ * which for symmetric matrices coincides with the incomplete Cholesky
+ * factorization in the form of LDL^T. The algebraic multigrid preconditioner
+ * uses smoothed aggregation with damped Jacobi smoothing in a V-cycle.
+ *
+ * @author T
+ * @date 21/10/2017
+ * @version 0.1.0
+ * @file IterativeSolver.hpp
+ * @addtogroup MetaMat
+ * @{
+ */
+
+#ifndef ITERATIVESOLVER_HPP
+#define ITERATIVESOLVER_HPP
+
+#include <suanPan.h>
+#include <vector>
+
+using std::vector;
+
+enum class IterativeSolver { NONE, PCG, BICGSTAB, GMRES };
+enum class PreconditionerType { NONE, JACOBI, ILU, AMG };
+
+template <typename T> struct IterativeSetting {
+    IterativeSolver solver = IterativeSolver::NONE;
+    PreconditionerType preconditioner = PreconditionerType::JACOBI;
+    T tolerance = T(1E-10);    /**< relative residual tolerance */
+    unsigned max_iteration = 0; /**< zero means the size of the system */
+    unsigned restart = 50;      /**< subspace size of GMRES */
+};
+
+template <typename T> class Preconditioner {
+public:
+    virtual ~Preconditioner() = default;
+
+    virtual Col<T> apply(const Col<T>&) const = 0;
+};
+
+template <typename T> class IdentityPreconditioner final : public Preconditioner<T> {
+public:
+    Col<T> apply(const Col<T>& R) const override { return R; }
+};
+
+template <typename T> class JacobiPreconditioner final : public Preconditioner<T> {
+    Col<T> inv_diag;
+
+public:
+    explicit JacobiPreconditioner(const SpMat<T>& A)
+        : inv_diag(A.diag()) {
+        inv_diag.transform([](const T& D) { return D == T(0) ? T(1) : T(1) / D; });
+    }
+
+    Col<T> apply(const Col<T>& R) const override { return inv_diag % R; }
+};
+
+/**
+ * @brief ILU(0) factorization of a compressed column matrix.
+ *
+ * The column arrays of A are the row arrays of A^T, the factorization
+ * A^T=LU is computed row by row on the same pattern so that A=U^T L^T.
+ */
+template <typename T> class ILUPreconditioner final : public Preconditioner<T> {
+    const uword n_size;
+    const uvec col_ptr, row_idx;
+    uvec diag_ptr;
+    Col<T> value;
+
+public:
+    ILUPreconditioner(const uword& N, const uvec& C, const uvec& R, const T* const V)
+        : n_size(N)
+        , col_ptr(C)
+        , row_idx(R)
+        , diag_ptr(N)
+        , value(V, R.n_elem) {
+        for(uword I = 0; I < n_size; ++I) {
+            diag_ptr(I) = col_ptr(I + 1);
+            for(auto J = col_ptr(I); J < col_ptr(I + 1); ++J)
+                if(row_idx(J) == I) {
+                    diag_ptr(I) = J;
+                    break;
+                }
+        }
+
+        Col<sword> position(n_size);
+        position.fill(-1);
+
+        for(uword I = 0; I < n_size; ++I) {
+            for(auto J = col_ptr(I); J < col_ptr(I + 1); ++J) position(row_idx(J)) = sword(J);
+            for(auto J = col_ptr(I); J < col_ptr(I + 1) && row_idx(J) < I; ++J) {
+                const auto K = row_idx(J);
+                if(diag_ptr(K) == col_ptr(K + 1) || value(diag_ptr(K)) == T(0)) continue;
+                value(J) /= value(diag_ptr(K));
+                for(auto L = diag_ptr(K) + 1; L < col_ptr(K + 1); ++L)
+                    if(position(row_idx(L)) >= 0) value(position(row_idx(L))) -= value(J) * value(L);
+            }
+            for(auto J = col_ptr(I); J < col_ptr(I + 1); ++J) position(row_idx(J)) = -1;
+        }
+    }
+
+    Col<T> apply(const Col<T>& R) const override {
+        Col<T> X = R;
+        // U^T Y = R
+        for(uword I = 0; I < n_size; ++I) {
+            if(diag_ptr(I) == col_ptr(I + 1) || value(diag_ptr(I)) == T(0)) continue;
+            X(I) /= value(diag_ptr(I));
+            for(auto J = diag_ptr(I) + 1; J < col_ptr(I + 1); ++J) X(row_idx(J)) -= value(J) * X(I);
+        }
+        // L^T X = Y
+        for(auto I = n_size; I > 0; --I)
+            for(auto J = col_ptr(I - 1); J < col_ptr(I) && row_idx(J) < I - 1; ++J) X(row_idx(J)) -= value(J) * X(I - 1);
+        return X;
+    }
+};
+
+template <typename T> class AMGPreconditioner final : public Preconditioner<T> {
+    struct Level {
+        SpMat<T> A, P, R;
+        Col<T> inv_diag;
+    };
+
+    vector<Level> level;
+    Mat<T> coarse_inverse;
+
+    static constexpr unsigned max_level = 10;
+    static constexpr uword min_size = 200;
+    static constexpr unsigned num_sweep = 2;
+
+    const T strength = T(.08);
+    const T jacobi_weight = T(2. / 3.);
+
+    static Col<T> get_inv_diag(const SpMat<T>& A) {
+        Col<T> D(A.diag());
+        D.transform([](const T& V) { return V == T(0) ? T(1) : T(1) / V; });
+        return D;
+    }
+
+    uvec aggregate(const SpMat<T>& A, uword& num_aggregate) const {
+        const uword N = A.n_cols;
+        const Col<T> D = abs(Col<T>(A.diag()));
+        const auto unassigned = N;
+
+        auto is_strong = [&](const uword I, const uword J, const T& V) { return I != J && std::abs(V) >= strength * std::sqrt(D(I) * D(J)); };
+
+        uvec agg(N);
+        agg.fill(unassigned);
+        num_aggregate = 0;
+
+        // form aggregates from nodes with all strong neighbours free
+        for(uword I = 0; I < N; ++I) {
+            if(agg(I) != unassigned) continue;
+            auto free = true;
+            for(auto J = A.begin_col(I); J != A.end_col(I); ++J)
+                if(is_strong(J.row(), I, *J) && agg(J.row()) != unassigned) {
+                    free = false;
+                    break;
+                }
+            if(!free) continue;
+            agg(I) = num_aggregate;
+            for(auto J = A.begin_col(I); J != A.end_col(I); ++J)
+                if(is_strong(J.row(), I, *J)) agg(J.row()) = num_aggregate;
+            ++num_aggregate;
+        }
+
+        // attach remaining nodes to a neighbouring aggregate
+        const uvec first_pass = agg;
+        for(uword I = 0; I < N; ++I) {
+            if(agg(I) != unassigned) continue;
+            for(auto J = A.begin_col(I); J != A.end_col(I); ++J)
+                if(is_strong(J.row(), I, *J) && first_pass(J.row()) != unassigned) {
+                    agg(I) = first_pass(J.row());
+                    break;
+                }
+        }
+
+        // isolated nodes form their own aggregates
+        for(uword I = 0; I < N; ++I)
+            if(agg(I) == unassigned) agg(I) = num_aggregate++;
+
+        return agg;
+    }
+
+    Col<T> cycle(const size_t& L, const Col<T>& B) const {
+        if(L == level.size()) return coarse_inverse * B;
+
+        const auto& C = level[L];
+
+        Col<T> X = jacobi_weight * C.inv_diag % B;
+        for(unsigned I = 1; I < num_sweep; ++I) X += jacobi_weight * C.inv_diag % (B - C.A * X);
+
+        X += C.P * cycle(L + 1, Col<T>(C.R * (B - C.A * X)));
+
+        for(unsigned I = 0; I < num_sweep; ++I) X += jacobi_weight * C.inv_diag % (B - C.A * X);
+
+        return X;
+    }
+
+public:
+    explicit AMGPreconditioner(const SpMat<T>& A) {
+        SpMat<T> t_a = A;
+
+        while(t_a.n_cols > min_size && level.size() < max_level) {
+            uword num_aggregate;
+            const auto agg = aggregate(t_a, num_aggregate);
+            if(num_aggregate == 0 || num_aggregate >= t_a.n_cols) break;
+
+            // tentative prolongator with normalised columns
+            Col<T> agg_size(num_aggregate, fill::zeros);
+            for(const auto& I : agg) agg_size(I) += T(1);
+            umat location(2, t_a.n_cols);
+            Col<T> weight(t_a.n_cols);
+            for(uword I = 0; I < t_a.n_cols; ++I) {
+                location(0, I) = I;
+                location(1, I) = agg(I);
+                weight(I) = T(1) / std::sqrt(agg_size(agg(I)));
+            }
+            const SpMat<T> t_p(location, weight, t_a.n_cols, num_aggregate);
+
+            Level t_level;
+            t_level.inv_diag = get_inv_diag(t_a);
+
+            umat d_location(2, t_a.n_cols);
+            for(uword I = 0; I < t_a.n_cols; ++I) d_location(0, I) = d_location(1, I) = I;
+            const SpMat<T> t_dinv_a = SpMat<T>(d_location, t_level.inv_diag, t_a.n_cols, t_a.n_cols) * t_a;
+
+            // spectral radius of D^{-1}A by power iteration
+            Col<T> t_v(t_a.n_cols, fill::randu);
+            auto t_rho = T(1);
+            for(auto I = 0; I < 10; ++I) {
+                const Col<T> t_w = t_dinv_a * t_v;
+                t_rho = norm(t_w) / norm(t_v);
+                if(t_rho == T(0)) break;
+                t_v = t_w / norm(t_w);
+            }
+
+            t_level.P = t_p - T(4. / 3.) / std::max(t_rho, T(1E-12)) * t_dinv_a * t_p;
+            t_level.R = t_level.P.t();
+            t_level.A = t_a;
+
+            t_a = t_level.R * t_a * t_level.P;
+
+            level.emplace_back(std::move(t_level));
+        }
+
+        if(!inv(coarse_inverse, Mat<T>(t_a))) coarse_inverse = pinv(Mat<T>(t_a));
+    }
+
+    Col<T> apply(const Col<T>& R) const override { return cycle(0, R); }
+};
+
+template <typename T, typename F, typename P> int pcg(const F& A, const P& M, Col<T>& X, const Col<T>& B, const T& tol, const unsigned& max_iteration) {
+    const auto norm_b = norm(B);
+    if(norm_b == T(0)) {
+        X.zeros();
+        return 0;
+    }
+
+    Col<T> R = B - A(X);
+    Col<T> Z = M(R);
+    Col<T> D = Z;
+    auto rz = dot(R, Z);
+
+    for(unsigned I = 0; I < max_iteration; ++I) {
+        if(norm(R) <= tol * norm_b) return 0;
+        const Col<T> Q = A(D);
+        const auto alpha = rz / dot(D, Q);
+        X += alpha * D;
+        R -= alpha * Q;
+        Z = M(R);
+        const auto rz_new = dot(R, Z);
+        D = Z + rz_new / rz * D;
+        rz = rz_new;
+    }
+
+    return norm(R) <= tol * norm_b ? 0 : 1;
+}
+
+template <typename T, typename F, typename P> int bicgstab(const F& A, const P& M, Col<T>& X, const Col<T>& B, const T& tol, const unsigned& max_iteration) {
+    const auto norm_b = norm(B);
+    if(norm_b == T(0)) {
+        X.zeros();
+        return 0;
+    }
+
+    Col<T> R = B - A(X);
+    const Col<T> R0 = R;
+    Col<T> V(B.n_elem, fill::zeros), D(B.n_elem, fill::zeros);
+    auto rho = T(1), alpha = T(1), omega = T(1);
+
+    for(unsigned I = 0; I < max_iteration; ++I) {
+        if(norm(R) <= tol * norm_b) return 0;
+        const auto rho_new = dot(R0, R);
+        if(rho_new == T(0) || omega == T(0)) break;
+        D = R + rho_new / rho * alpha / omega * (D - omega * V);
+        const Col<T> Y = M(D);
+        V = A(Y);
+        alpha = rho_new / dot(R0, V);
+        const Col<T> S = R - alpha * V;
+        if(norm(S) <= tol * norm_b) {
+            X += alpha * Y;
+            return 0;
+        }
+        const Col<T> Z = M(S);
+        const Col<T> W = A(Z);
+        omega = dot(W, S) / dot(W, W);
+        X += alpha * Y + omega * Z;
+        R = S - omega * W;
+        rho = rho_new;
+    }
+
+    return norm(R) <= tol * norm_b ? 0 : 1;
+}
+
+template <typename T, typename F, typename P> int gmres(const F& A, const P& M, Col<T>& X, const Col<T>& B, const T& tol, const unsigned& max_iteration, const unsigned& restart) {
+    const auto norm_b = norm(B);
+    if(norm_b == T(0)) {
+        X.zeros();
+        return 0;
+    }
+
+    const auto m = std::max(1u, std::min(restart, unsigned(B.n_elem)));
+
+    Mat<T> V(B.n_elem, m + 1), H(m + 1, m);
+    Col<T> cs(m), sn(m), g(m + 1);
+
+    unsigned counter = 0;
+
+    while(counter < max_iteration) {
+        Col<T> R = B - A(X);
+        const auto beta = norm(R);
+        if(beta <= tol * norm_b) return 0;
+
+        V.col(0) = R / beta;
+        H.zeros();
+        g.zeros();
+        g(0) = beta;
+
+        unsigned K = 0;
+        while(K < m && counter < max_iteration) {
+            Col<T> W = A(M(V.col(K)));
+            for(unsigned I = 0; I <= K; ++I) {
+                H(I, K) = dot(W, V.col(I));
+                W -= H(I, K) * V.col(I);
+            }
+            H(K + 1, K) = norm(W);
+            if(H(K + 1, K) != T(0)) V.col(K + 1) = W / H(K + 1, K);
+
+            for(unsigned I = 0; I < K; ++I) {
+                const auto t_h = cs(I) * H(I, K) + sn(I) * H(I + 1, K);
+                H(I + 1, K) = -sn(I) * H(I, K) + cs(I) * H(I + 1, K);
+                H(I, K) = t_h;
+            }
+            const auto t_r = std::sqrt(H(K, K) * H(K, K) + H(K + 1, K) * H(K + 1, K));
+            cs(K) = t_r == T(0) ? T(1) : H(K, K) / t_r;
+            sn(K) = t_r == T(0) ? T(0) : H(K + 1, K) / t_r;
+            H(K, K) = t_r;
+            H(K + 1, K) = T(0);
+            g(K + 1) = -sn(K) * g(K);
+            g(K) *= cs(K);
+
+            ++K;
+            ++counter;
+
+            if(std::abs(g(K)) <= tol * norm_b) break;
+        }
+
+        const Col<T> Y = solve(trimatu(H(0, 0, arma::size(K, K))), g.head(K));
+        X += M(V.head_cols(K) * Y);
+
+        if(std::abs(g(K)) <= tol * norm_b) return 0;
+    }
+
+    return norm(B - A(X)) <= tol * norm_b ? 0 : 1;
+}
+
+#endif
+
+//! @}
@@ -47,6 +47,8 @@ public:
     virtual const T& operator()(const uword&, const uword&) const;
     virtual T& at(const uword&, const uword&);
 
+    virtual uword offset(const uword&, const uword&) const;
+
     const T* memptr() const;
     T* memptr();
 
@@ -164,6 +166,11 @@ template <typename T> const T& MetaMat<T>::operator()(const uword& in_row, const
 
 template <typename T> T& MetaMat<T>::at(const uword& in_row, const uword& in_col) { return access::rw(memory[in_row + in_col * n_rows]); }
 
+/**
+ * \brief Returns the position of the given entry in `memory`, or `n_elem` if the entry is not stored.
+ */
+template <typename T> uword MetaMat<T>::offset(const uword& in_row, const uword& in_col) const { return in_row + in_col * n_rows; }
+
 template <typename T> const T* MetaMat<T>::memptr() const { return memory; }
 
 template <typename T> T* MetaMat<T>::memptr() { return const_cast<T*>(memory); }
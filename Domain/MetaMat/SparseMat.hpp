@@ -0,0 +1,412 @@
+/**
+ * @class SparseMat
+ * @brief A SparseMat class that holds matrices in compressed column format.
+ *
+ * The sparsity pattern is fixed at construction and is normally obtained
+ * from the element connectivity. Only entries within the pattern can be
+ * accessed by `at()`, all other entries are zero.
+ *
+ * With SuperLU available, the ordering and the elimination tree are computed
+ * by the first `solve()` and reused by all following factorizations, only the
+ * numeric factorization is performed once the matrix is reassembled.
+ *
+ * Alternatively, a preconditioned Krylov solver can be chosen via
+ * `set_iterative_setting()`. The preconditioner is then built by `solve()`
+ * and reused by `solve_trs()`, the content of `X` is used as the initial
+ * guess if it reduces the residual.
+ *
+ * @author T
+ * @date 21/10/2017
+ * @version 0.3.0
+ * @file SparseMat.hpp
+ * @addtogroup MetaMat
+ * @{
+ */
+
+#ifndef SPARSEMAT_HPP
+#define SPARSEMAT_HPP
+
+#include <suanPan.h>
+
+template <typename T> class SparseMat : public MetaMat<T> {
+    static thread_local T bin;
+    using MetaMat<T>::i;
+    using MetaMat<T>::inv;
+
+    const uvec col_ptr; /**< column pointers, size of n_cols+1 */
+    const uvec row_idx; /**< sorted row indices of each column */
+
+    IterativeSetting<T> setting;
+    shared_ptr<Preconditioner<T>> preconditioner = nullptr;
+
+    Col<T> multiply(const Col<T>&) const;
+    int iterative_solve(Mat<T>&, const Mat<T>&);
+
+#ifdef ARMA_USE_SUPERLU
+    Col<int> t_col_ptr, t_row_idx; /**< pattern in SuperLU index type */
+    Col<int> perm_c, perm_r, etree;
+    Col<T> R, C;
+    char equed = 'N';
+
+    bool symbolic = false; /**< ordering and elimination tree are available */
+    bool numeric = false;  /**< L and U are available */
+
+    superlu::superlu_options_t options;
+    superlu::GlobalLU_t glu;
+    superlu::SuperMatrix L, U;
+
+    void release_numeric();
+    int superlu_solve(Mat<T>&, const Mat<T>&);
+#else
+    shared_ptr<BandMat<T>> band_factor = nullptr;
+#endif
+
+public:
+    using MetaMat<T>::IPIV;
+    using MetaMat<T>::TRAN;
+    using MetaMat<T>::factored;
+    using MetaMat<T>::n_cols;
+    using MetaMat<T>::n_rows;
+    using MetaMat<T>::n_elem;
+    using MetaMat<T>::memory;
+    using MetaMat<T>::solve;
+    using MetaMat<T>::solve_trs;
+    using MetaMat<T>::factorize;
+
+    SparseMat();
+    SparseMat(const unsigned&, const uvec&, const uvec&);
+    SparseMat(const SparseMat&);
+    SparseMat& operator=(const SparseMat&) = delete;
+    ~SparseMat();
+
+    const uvec& get_col_ptr() const;
+    const uvec& get_row_idx() const;
+
+    void set_iterative_setting(const IterativeSetting<T>&);
+    const IterativeSetting<T>& get_iterative_setting() const;
+
+    const T& operator()(const uword&, const uword&) const override;
+    T& at(const uword&, const uword&) override;
+
+    uword offset(const uword&, const uword&) const override;
+
+    Mat<T> operator*(const Mat<T>&)override;
+
+    int solve(Mat<T>&, const Mat<T>&) override;
+    int solve_trs(Mat<T>&, const Mat<T>&) override;
+
+    MetaMat<T> factorize() override;
+};
+
+template <typename T> struct is_Sparse { static const bool value = false; };
+
+template <typename T> struct is_Sparse<SparseMat<T>> { static const bool value = true; };
+
+template <typename T> thread_local T SparseMat<T>::bin = 0.;
+
+template <typename T> uword SparseMat<T>::offset(const uword& in_row, const uword& in_col) const {
+    const auto t_begin = row_idx.begin() + col_ptr(in_col);
+    const auto t_end = row_idx.begin() + col_ptr(in_col + 1);
+    const auto t_pos = std::lower_bound(t_begin, t_end, in_row);
+    return t_pos == t_end || *t_pos != in_row ? n_elem : uword(t_pos - row_idx.begin());
+}
+
+template <typename T>
+SparseMat<T>::SparseMat()
+    : MetaMat<T>() {}
+
+template <typename T>
+SparseMat<T>::SparseMat(const unsigned& in_size, const uvec& in_col_ptr, const uvec& in_row_idx)
+    : MetaMat<T>(in_size, in_size, unsigned(in_row_idx.n_elem))
+    , col_ptr(in_col_ptr)
+    , row_idx(in_row_idx) {}
+
+template <typename T>
+SparseMat<T>::SparseMat(const SparseMat& old_mat)
+    : MetaMat<T>(old_mat)
+    , col_ptr(old_mat.col_ptr)
+    , row_idx(old_mat.row_idx)
+    , setting(old_mat.setting) {
+    // factorization is not shared among copies
+    factored = false;
+}
+
+template <typename T> SparseMat<T>::~SparseMat() {
+#ifdef ARMA_USE_SUPERLU
+    release_numeric();
+#endif
+}
+
+template <typename T> const uvec& SparseMat<T>::get_col_ptr() const { return col_ptr; }
+
+template <typename T> const uvec& SparseMat<T>::get_row_idx() const { return row_idx; }
+
+template <typename T> void SparseMat<T>::set_iterative_setting(const IterativeSetting<T>& S) {
+    setting = S;
+    preconditioner = nullptr;
+    factored = false;
+}
+
+template <typename T> const IterativeSetting<T>& SparseMat<T>::get_iterative_setting() const { return setting; }
+
+template <typename T> const T& SparseMat<T>::operator()(const uword& in_row, const uword& in_col) const {
+    const auto t_idx = offset(in_row, in_col);
+    if(t_idx == n_elem) {
+        bin = 0.;
+        return bin;
+    }
+
+    return memory[t_idx];
+}
+
+template <typename T> T& SparseMat<T>::at(const uword& in_row, const uword& in_col) {
+    const auto t_idx = offset(in_row, in_col);
+    if(t_idx == n_elem) throw logic_error("index is not in the sparsity pattern.");
+
+    return access::rw(memory[t_idx]);
+}
+
+template <typename T> Mat<T> SparseMat<T>::operator*(const Mat<T>& X) {
+    Mat<T> Y(n_rows, X.n_cols, fill::zeros);
+
+    for(uword K = 0; K < X.n_cols; ++K) {
+        const auto t_x = X.colptr(K);
+        const auto t_y = Y.colptr(K);
+        for(uword J = 0; J < n_cols; ++J) {
+            const auto t_value = t_x[J];
+            if(t_value == 0.) continue;
+            for(auto I = col_ptr(J); I < col_ptr(J + 1); ++I) t_y[row_idx(I)] += memory[I] * t_value;
+        }
+    }
+
+    return Y;
+}
+
+template <typename T> int SparseMat<T>::solve(Mat<T>& X, const Mat<T>& B) {
+    if(factored) {
+        suanpan_warning("the matrix is factored.\n");
+        return this->solve_trs(X, B);
+    }
+
+    if(setting.solver != IterativeSolver::NONE) {
+        switch(setting.preconditioner) {
+        case PreconditionerType::NONE:
+            preconditioner = make_shared<IdentityPreconditioner<T>>();
+            break;
+        case PreconditionerType::JACOBI:
+            preconditioner = make_shared<JacobiPreconditioner<T>>(SpMat<T>(row_idx, col_ptr, Col<T>(memory, n_elem), n_rows, n_cols));
+            break;
+        case PreconditionerType::ILU:
+            preconditioner = make_shared<ILUPreconditioner<T>>(n_cols, col_ptr, row_idx, memory);
+            break;
+        case PreconditionerType::AMG:
+            preconditioner = make_shared<AMGPreconditioner<T>>(SpMat<T>(row_idx, col_ptr, Col<T>(memory, n_elem), n_rows, n_cols));
+            break;
+        }
+
+        factored = true;
+
+        return iterative_solve(X, B);
+    }
+
+#ifdef ARMA_USE_SUPERLU
+    if(!symbolic) {
+        superlu::set_default_opts(&options);
+        // the pattern is structurally symmetric, prefer diagonal pivots
+        options.ColPerm = superlu::MMD_AT_PLUS_A;
+        options.SymmetricMode = superlu::YES;
+        options.DiagPivotThresh = .1;
+        options.Equil = superlu::NO;
+        options.ConditionNumber = superlu::NO;
+        options.PrintStat = superlu::NO;
+
+        t_col_ptr = conv_to<Col<int>>::from(col_ptr);
+        t_row_idx = conv_to<Col<int>>::from(row_idx);
+        perm_c.zeros(n_cols + 1);
+        perm_r.zeros(n_rows + 1);
+        etree.zeros(n_cols + 1);
+        R.zeros(n_rows + 1);
+        C.zeros(n_cols + 1);
+        arrayops::inplace_set(reinterpret_cast<char*>(&glu), char(0), sizeof(superlu::GlobalLU_t));
+    }
+
+    release_numeric();
+
+    options.Fact = symbolic ? superlu::SamePattern : superlu::DOFACT;
+
+    const auto INFO = superlu_solve(X, B);
+
+    if(INFO == 0) {
+        symbolic = true;
+        factored = true;
+    } else
+        suanpan_error("solve() receives error code %d from SuperLU, the matrix is probably singular.\n", INFO);
+
+    return INFO;
+#else
+    // no sparse driver is available, the pattern is copied into a banded matrix
+    // which is compact after RCM reordering
+    unsigned low_bw = 0, up_bw = 0;
+    for(uword J = 0; J < n_cols; ++J)
+        for(auto I = col_ptr(J); I < col_ptr(J + 1); ++I)
+            if(row_idx(I) > J)
+                low_bw = std::max(low_bw, unsigned(row_idx(I) - J));
+            else
+                up_bw = std::max(up_bw, unsigned(J - row_idx(I)));
+
+    band_factor = make_shared<BandMat<T>>(n_cols, low_bw, up_bw);
+    for(uword J = 0; J < n_cols; ++J)
+        for(auto I = col_ptr(J); I < col_ptr(J + 1); ++I) band_factor->at(row_idx(I), J) = memory[I];
+
+    const auto INFO = band_factor->solve(X, B);
+
+    if(INFO == 0) factored = true;
+
+    return INFO;
+#endif
+}
+
+template <typename T> int SparseMat<T>::solve_trs(Mat<T>& X, const Mat<T>& B) {
+    if(!factored) {
+        suanpan_warning("the matrix is not factored.\n");
+        return this->solve(X, B);
+    }
+
+    if(setting.solver != IterativeSolver::NONE) return preconditioner == nullptr ? -1 : iterative_solve(X, B);
+
+#ifdef ARMA_USE_SUPERLU
+    if(!numeric) return -1;
+
+    options.Fact = superlu::FACTORED;
+
+    const auto INFO = superlu_solve(X, B);
+
+    if(INFO != 0) suanpan_error("solve() receives error code %d from SuperLU.\n", INFO);
+
+    return INFO;
+#else
+    if(band_factor == nullptr) return -1;
+
+    return band_factor->solve_trs(X, B);
+#endif
+}
+
+template <typename T> Col<T> SparseMat<T>::multiply(const Col<T>& X) const {
+    Col<T> Y(n_rows, fill::zeros);
+
+    for(uword J = 0; J < n_cols; ++J) {
+        const auto t_value = X(J);
+        if(t_value == 0.) continue;
+        for(auto I = col_ptr(J); I < col_ptr(J + 1); ++I) Y(row_idx(I)) += memory[I] * t_value;
+    }
+
+    return Y;
+}
+
+template <typename T> int SparseMat<T>::iterative_solve(Mat<T>& X, const Mat<T>& B) {
+    const auto max_iteration = unsigned(setting.max_iteration == 0 ? n_cols : setting.max_iteration);
+
+    auto t_a = [&](const Col<T>& V) { return multiply(V); };
+    auto t_m = [&](const Col<T>& V) { return preconditioner->apply(V); };
+
+    if(X.n_rows != B.n_rows || X.n_cols != B.n_cols) X.zeros(arma::size(B));
+
+    auto INFO = 0;
+
+    for(uword I = 0; I < B.n_cols; ++I) {
+        const Col<T> t_b = B.col(I);
+        Col<T> t_x = X.col(I);
+
+        // the previous solution is kept as the initial guess only if it is better than zero
+        if(!t_x.is_finite() || norm(t_b - multiply(t_x)) >= norm(t_b)) t_x.zeros();
+
+        auto flag = 0;
+        switch(setting.solver) {
+        case IterativeSolver::PCG:
+            flag = pcg(t_a, t_m, t_x, t_b, setting.tolerance, max_iteration);
+            break;
+        case IterativeSolver::BICGSTAB:
+            flag = bicgstab(t_a, t_m, t_x, t_b, setting.tolerance, max_iteration);
+            break;
+        case IterativeSolver::GMRES:
+            flag = gmres(t_a, t_m, t_x, t_b, setting.tolerance, max_iteration, setting.restart);
+            break;
+        case IterativeSolver::NONE:
+            break;
+        }
+
+        X.col(I) = t_x;
+
+        if(flag != 0) INFO = flag;
+    }
+
+    if(INFO != 0) suanpan_error("solve() does not converge within %u iterations.\n", max_iteration);
+
+    return INFO;
+}
+
+#ifdef ARMA_USE_SUPERLU
+template <typename T> void SparseMat<T>::release_numeric() {
+    if(!numeric) return;
+    superlu::destroy_supernode_mat(&L);
+    superlu::destroy_compcol_mat(&U);
+    numeric = false;
+}
+
+template <typename T> int SparseMat<T>::superlu_solve(Mat<T>& X, const Mat<T>& B) {
+    auto t_type = superlu::SLU_D;
+    if(std::is_same<T, float>::value) t_type = superlu::SLU_S;
+
+    // all wrappers reuse existing memory, only stores are allocated and freed here
+    const auto A_store = (superlu::NCformat*)superlu::malloc(sizeof(superlu::NCformat));
+    A_store->nnz = int(n_elem);
+    A_store->nzval = (void*)memory;
+    A_store->rowind = t_row_idx.memptr();
+    A_store->colptr = t_col_ptr.memptr();
+
+    Mat<T> t_B = B;
+    X.zeros(arma::size(B));
+
+    const auto B_store = (superlu::DNformat*)superlu::malloc(sizeof(superlu::DNformat));
+    B_store->lda = int(t_B.n_rows);
+    B_store->nzval = (void*)t_B.memptr();
+
+    const auto X_store = (superlu::DNformat*)superlu::malloc(sizeof(superlu::DNformat));
+    X_store->lda = int(X.n_rows);
+    X_store->nzval = (void*)X.memptr();
+
+    superlu::SuperMatrix A{ superlu::SLU_NC, t_type, superlu::SLU_GE, int(n_rows), int(n_cols), A_store };
+    superlu::SuperMatrix SB{ superlu::SLU_DN, t_type, superlu::SLU_GE, int(t_B.n_rows), int(t_B.n_cols), B_store };
+    superlu::SuperMatrix SX{ superlu::SLU_DN, t_type, superlu::SLU_GE, int(X.n_rows), int(X.n_cols), X_store };
+
+    Col<T> ferr(B.n_cols + 1), berr(B.n_cols + 1);
+    T rpg = 0., rcond = 0.;
+
+    superlu::mem_usage_t mu;
+    superlu::SuperLUStat_t stat;
+    superlu::init_stat(&stat);
+
+    char work[8];
+    auto INFO = 0;
+
+    superlu::gssvx<T>(&options, &A, perm_c.memptr(), perm_r.memptr(), etree.memptr(), &equed, R.memptr(), C.memptr(), &L, &U, &work[0], 0, &SB, &SX, &rpg, &rcond, ferr.memptr(), berr.memptr(), &glu, &mu, &stat, &INFO);
+
+    superlu::free_stat(&stat);
+
+    superlu::destroy_dense_mat(&A);
+    superlu::destroy_dense_mat(&SB);
+    superlu::destroy_dense_mat(&SX);
+
+    // L and U exist once the factorization completes, even for singular matrices
+    if(options.Fact != superlu::FACTORED && INFO >= 0 && INFO <= int(n_cols)) numeric = true;
+
+    return INFO;
+}
+#endif
+
+// a dense factorization defeats the sparse storage, solve() calls SuperLU directly instead
+template <typename T> MetaMat<T> SparseMat<T>::factorize() { throw logic_error("SparseMat does not support factorize(), use solve() instead.\n"); }
+
+#endif
+
+//! @}
@@ -14,7 +14,7 @@
 #define SYMMPACKMAT_HPP
 
 template <typename T> class SymmPackMat : public MetaMat<T> {
-    static T bin;
+    static thread_local T bin;
     const char SIDE = 'R';
     const char UPLO = 'U';
 
@@ -36,6 +36,8 @@ public:
     const T& operator()(const uword&, const uword&) const override;
     T& at(const uword&, const uword&) override;
 
+    uword offset(const uword&, const uword&) const override;
+
     Mat<T> operator*(const Mat<T>&)override;
 
     int solve(Mat<T>&, const Mat<T>&) override;
@@ -50,7 +52,7 @@ template <typename T> struct is_SymmPack { static const bool value = false; };
 
 template <typename T> struct is_SymmPack<SymmPackMat<T>> { static const bool value = true; };
 
-template <typename T> T SymmPackMat<T>::bin = 0.;
+template <typename T> thread_local T SymmPackMat<T>::bin = 0.;
 
 template <typename T>
 SymmPackMat<T>::SymmPackMat()
@@ -67,6 +69,11 @@ template <typename T> T& SymmPackMat<T>::at(const uword& in_row, const uword& in
     return access::rw(memory[(in_col * in_col + in_col) / 2 + in_row]);
 }
 
+template <typename T> uword SymmPackMat<T>::offset(const uword& in_row, const uword& in_col) const {
+    if(in_col < in_row) return n_elem;
+    return (in_col * in_col + in_col) / 2 + in_row;
+}
+
 template <const char S, const char T, typename T1> Mat<T1> spmm(const SymmPackMat<T1>& A, const Mat<T1>& B);
 
 template <typename T> Mat<T> SymmPackMat<T>::operator*(const Mat<T>& X) {
@@ -17,6 +17,7 @@
 
 #include "Node.h"
 #include <Domain/DomainBase.h>
+#include <Domain/Factory.hpp>
 #include <Recorder/OutputType.h>
 
 /**
@@ -71,9 +72,11 @@ Node::Node(const unsigned& T, const unsigned& D, const vec& C)
 Node::~Node() { suanpan_debug("Node %u dtor() called.\n", get_tag()); }
 
 /**
- * \brief This method should be called after Element objects are set. Element objects will set the minimum number of DoFs for all related Node objects. This method initialize all member variables with the size of `num_dof` and fill `original_dof` with `-1` to indicated it should be omitted from the system. Finally check if the size of `coordinate` is the same of `num_dof`, if not, resize it to `num_dof`. This will be necessary for beam/plate/shell problems which have more DoFs than coordinates.
+ * \brief This method should be called after Element objects are set. Element objects will set the minimum number of DoFs for all related Node objects. This method fills `original_dof` with `-1` to indicated it should be omitted from the system. Status variables are views into the Factory of the Domain, there is nothing to allocate.
  */
 void Node::initialize(const shared_ptr<DomainBase>& D) {
+    factory = D->get_factory();
+
     if(initialized || !is_active()) return;
 
     if(num_dof != 0) {
@@ -82,21 +85,6 @@ void Node::initialize(const shared_ptr<DomainBase>& D) {
 
         reordered_dof.reset();
 
-        current_resistance.resize(num_dof);
-        current_displacement.resize(num_dof);
-        current_velocity.resize(num_dof);
-        current_acceleration.resize(num_dof);
-
-        incre_resistance.resize(num_dof);
-        incre_displacement.resize(num_dof);
-        incre_velocity.resize(num_dof);
-        incre_acceleration.resize(num_dof);
-
-        trial_resistance.resize(num_dof);
-        trial_displacement.resize(num_dof);
-        trial_velocity.resize(num_dof);
-        trial_acceleration.resize(num_dof);
-
         // if(num_dof > coordinate.n_elem) coordinate.resize(num_dof);
     } else {
         suanpan_debug("Node %u is not used in the problem, now disable it.\n", get_tag());
@@ -106,6 +94,32 @@ void Node::initialize(const shared_ptr<DomainBase>& D) {
     initialized = true;
 }
 
+/**
+ * \brief Gathers the entries of the DoFs of the node from a global vector.
+ * \param F getter of the global vector
+ * \return zeros if the global vector is not available
+ */
+vec Node::gather(const Col<double>& (Factory<double>::*F)() const) const {
+    const auto& t_dof = get_reordered_dof();
+    if(factory != nullptr && !t_dof.is_empty()) {
+        const auto& t_state = (*factory.*F)();
+        if(t_dof.max() < t_state.n_elem) return t_state(t_dof);
+    }
+    return zeros<vec>(num_dof);
+}
+
+/**
+ * \brief Writes the entries of the DoFs of the node to a global vector.
+ * \param F accessor of the global vector
+ * \param V nodal values
+ */
+void Node::scatter(Col<double>& (*F)(const shared_ptr<Factory<double>>&), const vec& V) const {
+    const auto& t_dof = get_reordered_dof();
+    if(factory == nullptr || t_dof.is_empty() || t_dof.n_elem != V.n_elem) return;
+    auto& t_state = F(factory);
+    if(t_dof.max() < t_state.n_elem) t_state(t_dof) = V;
+}
+
 /**
  * \brief Method to set `num_dof`.
  * \param D `num_dof`
@@ -192,316 +206,150 @@ void Node::set_coordinate(const vec& C) { coordinate = C; }
  */
 const vec& Node::get_coordinate() const { return coordinate; }
 
-void Node::set_current_resistance(const vec& R) { current_resistance = R; }
+void Node::set_current_resistance(const vec& R) { scatter(&::get_current_resistance<double>, R); }
 
 /**
  * \brief Method to set variable independently.
  * \param D `current_displacement`
  */
-void Node::set_current_displacement(const vec& D) { current_displacement = D; }
+void Node::set_current_displacement(const vec& D) { scatter(&::get_current_displacement<double>, D); }
 
 /**
  * \brief Method to set variable independently.
  * \param V `current_velocity`
  */
-void Node::set_current_velocity(const vec& V) { current_velocity = V; }
+void Node::set_current_velocity(const vec& V) { scatter(&::get_current_velocity<double>, V); }
 
 /**
  * \brief Method to set variable independently.
  * \param A `current_acceleration`
  */
-void Node::set_current_acceleration(const vec& A) { current_acceleration = A; }
+void Node::set_current_acceleration(const vec& A) { scatter(&::get_current_acceleration<double>, A); }
 
-void Node::set_incre_resistance(const vec& R) { incre_resistance = R; }
+void Node::set_incre_resistance(const vec& R) { scatter(&::get_incre_resistance<double>, R); }
 
 /**
  * \brief Method to set variable independently.
  * \param D `incre_displacement`
  */
-void Node::set_incre_displacement(const vec& D) { incre_displacement = D; }
+void Node::set_incre_displacement(const vec& D) { scatter(&::get_incre_displacement<double>, D); }
 
 /**
  * \brief Method to set variable independently.
  * \param V `incre_velocity`
  */
-void Node::set_incre_velocity(const vec& V) { incre_velocity = V; }
+void Node::set_incre_velocity(const vec& V) { scatter(&::get_incre_velocity<double>, V); }
 
 /**
  * \brief Method to set variable independently.
  * \param A `incre_acceleration`
  */
-void Node::set_incre_acceleration(const vec& A) { incre_acceleration = A; }
+void Node::set_incre_acceleration(const vec& A) { scatter(&::get_incre_acceleration<double>, A); }
 
-void Node::set_trial_resistance(const vec& R) { trial_resistance = R; }
+void Node::set_trial_resistance(const vec& R) { scatter(&::get_trial_resistance<double>, R); }
 
 /**
  * \brief Method to set variable independently.
  * \param D `trial_displacement`
  */
-void Node::set_trial_displacement(const vec& D) { trial_displacement = D; }
+void Node::set_trial_displacement(const vec& D) { scatter(&::get_trial_displacement<double>, D); }
 
 /**
  * \brief Method to set variable independently.
  * \param V `trial_velocity`
  */
-void Node::set_trial_velocity(const vec& V) { trial_velocity = V; }
+void Node::set_trial_velocity(const vec& V) { scatter(&::get_trial_velocity<double>, V); }
 
 /**
  * \brief Method to set variable independently.
  * \param A `trial_acceleration`
  */
-void Node::set_trial_acceleration(const vec& A) { trial_acceleration = A; }
+void Node::set_trial_acceleration(const vec& A) { scatter(&::get_trial_acceleration<double>, A); }
 
-const vec& Node::get_current_resistance() const { return current_resistance; }
+vec Node::get_current_resistance() const { return gather(&Factory<double>::get_current_resistance); }
 
 /**
  * \brief Method to return `current_displacement`.
  * \return `current_displacement`
  */
-const vec& Node::get_current_displacement() const { return current_displacement; }
+vec Node::get_current_displacement() const { return gather(&Factory<double>::get_current_displacement); }
 
 /**
  * \brief Method to return `current_velocity`.
  * \return `current_velocity`
  */
-const vec& Node::get_current_velocity() const { return current_velocity; }
+vec Node::get_current_velocity() const { return gather(&Factory<double>::get_current_velocity); }
 
 /**
  * \brief Method to return `current_acceleration`.
  * \return `current_acceleration`
  */
-const vec& Node::get_current_acceleration() const { return current_acceleration; }
+vec Node::get_current_acceleration() const { return gather(&Factory<double>::get_current_acceleration); }
 
-const vec& Node::get_incre_resistance() const { return incre_resistance; }
+vec Node::get_incre_resistance() const { return gather(&Factory<double>::get_incre_resistance); }
 
 /**
  * \brief Method to return `incre_displacement`.
  * \return `incre_displacement`
  */
-const vec& Node::get_incre_displacement() const { return incre_displacement; }
+vec Node::get_incre_displacement() const { return gather(&Factory<double>::get_incre_displacement); }
 
 /**
  * \brief Method to return `incre_velocity`.
  * \return `incre_velocity`
  */
-const vec& Node::get_incre_velocity() const { return incre_velocity; }
+vec Node::get_incre_velocity() const { return gather(&Factory<double>::get_incre_velocity); }
 
 /**
  * \brief Method to return `incre_acceleration`.
  * \return `incre_acceleration`
  */
-const vec& Node::get_incre_acceleration() const { return incre_acceleration; }
+vec Node::get_incre_acceleration() const { return gather(&Factory<double>::get_incre_acceleration); }
 
-const vec& Node::get_trial_resistance() const { return trial_resistance; }
+vec Node::get_trial_resistance() const { return gather(&Factory<double>::get_trial_resistance); }
 
 /**
  * \brief Method to return `trial_displacement`.
  * \return `trial_displacement`
  */
-const vec& Node::get_trial_displacement() const { return trial_displacement; }
+vec Node::get_trial_displacement() const { return gather(&Factory<double>::get_trial_displacement); }
 
 /**
  * \brief Method to return `trial_velocity`.
  * \return `trial_velocity`
  */
-const vec& Node::get_trial_velocity() const { return trial_velocity; }
+vec Node::get_trial_velocity() const { return gather(&Factory<double>::get_trial_velocity); }
 
 /**
  * \brief Method to return `trial_acceleration`.
  * \return `trial_acceleration`
  */
-const vec& Node::get_trial_acceleration() const { return trial_acceleration; }
-
-void Node::update_current_resistance(const vec& R) {
-    trial_resistance = current_resistance = R(reordered_dof);
-    incre_resistance.zeros();
-}
-
-void Node::update_incre_resistance(const vec& R) {
-    incre_resistance = R(reordered_dof);
-    trial_resistance = current_resistance + incre_resistance;
-}
-
-void Node::update_trial_resistance(const vec& R) {
-    trial_resistance = R(reordered_dof);
-    incre_resistance = trial_resistance - current_resistance;
-}
-
-void Node::update_current_status(const vec& D) {
-    trial_displacement = current_displacement = D(reordered_dof);
-    incre_displacement.zeros();
-}
-
-void Node::update_current_status(const vec& D, const vec& V) {
-    trial_velocity = current_velocity = V(reordered_dof);
-    incre_velocity.zeros();
-    update_current_status(D);
-}
-
-void Node::update_current_status(const vec& D, const vec& V, const vec& A) {
-    trial_acceleration = current_acceleration = A(reordered_dof);
-    incre_acceleration.zeros();
-    update_current_status(D, V);
-}
-
-/**
- * \brief Method to update displacement.
- * \param D `incre_displacement`
- */
-void Node::update_incre_status(const vec& D) {
-    incre_displacement = D(reordered_dof);
-    trial_displacement = current_displacement + incre_displacement;
-}
-
-/**
- * \brief Method to update velocity and call previous method to further update displacement. This is used in Dynamic analysis.
- * \param D `incre_displacement`
- * \param V `incre_velocity`
- */
-void Node::update_incre_status(const vec& D, const vec& V) {
-    incre_velocity = V(reordered_dof);
-    trial_velocity = current_velocity + incre_velocity;
-    update_incre_status(D);
-}
-
-/**
- * \brief Method to update acceleration and call previous method to further update velocity and displacement. This is used in Dynamic analysis.
- * \param D `incre_displacement`
- * \param V `incre_velocity`
- * \param A `incre_acceleration`
- */
-void Node::update_incre_status(const vec& D, const vec& V, const vec& A) {
-    incre_acceleration = A(reordered_dof);
-    trial_acceleration = current_acceleration + incre_acceleration;
-    update_incre_status(D, V);
-}
-
-/**
- * \brief Method to update displacement.
- * \param D `trial_displacement`
- */
-void Node::update_trial_status(const vec& D) {
-    trial_displacement = D(reordered_dof);
-    incre_displacement = trial_displacement - current_displacement;
-}
-
-/**
- * \brief Method to update velocity and call previous method to further update displacement. This is used in Dynamic analysis.
- * \param D `trial_displacement`
- * \param V `trial_velocity`
- */
-void Node::update_trial_status(const vec& D, const vec& V) {
-    trial_velocity = V(reordered_dof);
-    incre_velocity = trial_velocity - current_velocity;
-    update_trial_status(D);
-}
-
-/**
- * \brief Method to update acceleration and call previous method to further update velocity and displacement. This is used in Dynamic analysis.
- * \param D `trial_displacement`
- * \param V `trial_velocity`
- * \param A `trial_acceleration`
- */
-void Node::update_trial_status(const vec& D, const vec& V, const vec& A) {
-    trial_acceleration = A(reordered_dof);
-    incre_acceleration = trial_acceleration - current_acceleration;
-    update_trial_status(D, V);
-}
-
-/**
- * \brief Method to commit the status variables.
- */
-void Node::commit_status() {
-    if(!trial_resistance.is_empty()) {
-        current_resistance = trial_resistance;
-        incre_resistance.zeros();
-    }
-    if(!trial_displacement.is_empty()) {
-        current_displacement = trial_displacement;
-        incre_displacement.zeros();
-    }
-    if(!trial_velocity.is_empty()) {
-        current_velocity = trial_velocity;
-        incre_displacement.zeros();
-    }
-    if(!trial_acceleration.is_empty()) {
-        current_acceleration = trial_acceleration;
-        incre_acceleration.zeros();
-    }
-}
-
-/**
- * \brief Method to reset the status, there is no need to call this method as those variables can be directly overwritten.
- */
-void Node::reset_status() {
-    if(!current_resistance.is_empty()) {
-        trial_resistance = current_resistance;
-        incre_resistance.zeros();
-    }
-    if(!current_displacement.is_empty()) {
-        trial_displacement = current_displacement;
-        incre_displacement.zeros();
-    }
-    if(!current_velocity.is_empty()) {
-        trial_velocity = current_velocity;
-        incre_velocity.zeros();
-    }
-    if(!current_acceleration.is_empty()) {
-        trial_acceleration = current_acceleration;
-        incre_acceleration.zeros();
-    }
-}
-
-/**
- * \brief The method tests each status variable before filling it by zeros. For any of them, empty means it is not used in analysis, then just keeps it unchanged.
- */
-void Node::clear_status() {
-    if(!current_resistance.is_empty()) {
-        current_resistance.zeros();
-        incre_resistance.zeros();
-        trial_resistance.zeros();
-    }
-    if(!current_displacement.is_empty()) {
-        current_displacement.zeros();
-        incre_displacement.zeros();
-        trial_displacement.zeros();
-    }
-    if(!current_velocity.is_empty()) {
-        current_velocity.zeros();
-        incre_velocity.zeros();
-        trial_velocity.zeros();
-    }
-    if(!current_acceleration.is_empty()) {
-        current_acceleration.zeros();
-        incre_acceleration.zeros();
-        trial_acceleration.zeros();
-    }
-}
+vec Node::get_trial_acceleration() const { return gather(&Factory<double>::get_trial_acceleration); }
 
 vector<vec> Node::record(const OutputType& L) const {
     vector<vec> data;
 
     switch(L) {
     case OutputType::RF:
-        data.push_back(current_resistance);
+        data.push_back(get_current_resistance());
         break;
     case OutputType::U:
-        data.push_back(current_displacement);
+        data.push_back(get_current_displacement());
         break;
     case OutputType::V:
-        data.push_back(current_velocity);
+        data.push_back(get_current_velocity());
         break;
     case OutputType::A:
-        data.push_back(current_acceleration);
+        data.push_back(get_current_acceleration());
         break;
     case OutputType::U1:
-        if(current_displacement.n_elem >= 1) data.emplace_back(std::initializer_list<double>{ current_displacement(0) });
+        if(num_dof >= 1) data.emplace_back(std::initializer_list<double>{ get_current_displacement()(0) });
         break;
     case OutputType::U2:
-        if(current_displacement.n_elem >= 2) data.emplace_back(std::initializer_list<double>{ current_displacement(1) });
+        if(num_dof >= 2) data.emplace_back(std::initializer_list<double>{ get_current_displacement()(1) });
         break;
     case OutputType::U3:
-        if(current_displacement.n_elem >= 3) data.emplace_back(std::initializer_list<double>{ current_displacement(2) });
+        if(num_dof >= 3) data.emplace_back(std::initializer_list<double>{ get_current_displacement()(2) });
         break;
     default:
         break;
@@ -517,11 +365,13 @@ void Node::print() {
     suanpan_info("Node %u:\n", get_tag());
     coordinate.t().print();
     suanpan_info("Displacement:\n");
-    current_displacement.t().print();
+    get_current_displacement().t().print();
+    const auto current_velocity = get_current_velocity();
     if(accu(current_velocity) != 0.) {
         suanpan_info("Velocity:\n");
         current_velocity.t().print();
     }
+    const auto current_acceleration = get_current_acceleration();
     if(accu(current_acceleration) != 0.) {
         suanpan_info("Acceleration:\n");
         current_acceleration.t().print();
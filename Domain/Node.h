@@ -18,7 +18,7 @@
  * @class Node
  * @brief The Node class holds the number of DoFs, coordinate, displacement, velocity and acceleration.
  *
- * The current/committed, incremental and trial status of displacement, velocity and acceleration are stored. These variables will be the communication bridge(s) between Domain, Workshop and Element objects. That is, Element objects do not directly get information from the Workshop. Instead, Workshop passes information to Node objects through the Domain, Element objects acquire new status from associated Node objects only. In this manner, the relationship between those modules remains simple.
+ * The current/committed, incremental and trial status of displacement, velocity, acceleration and resistance are not stored in the Node object. Instead, they are views into the global vectors of the Factory: each getter gathers the entries of the DoFs of the node and each setter writes them back. Elements acquire new status from associated Node objects only, but no per-iteration copy from the Factory to Node objects is required. Status of DoFs that are not available in the current analysis type, such as velocity in static analysis, reads as zeros.
  *
  * @author T
  * @date 22/07/2017
@@ -37,6 +37,7 @@ using std::vector;
 
 class DomainBase;
 enum class OutputType;
+template <typename T> class Factory;
 
 class Node final : public Tag {
     bool initialized = false;
@@ -48,20 +49,10 @@ class Node final : public Tag {
     uvec original_dof;  /**< original indices */
     uvec reordered_dof; /**< renumbered indices */
 
-    vec current_resistance;
-    vec current_displacement; /**< current displacement */
-    vec current_velocity;     /**< current velocity */
-    vec current_acceleration; /**< current acceleration */
+    shared_ptr<Factory<double>> factory; /**< global status the views refer to */
 
-    vec incre_resistance;
-    vec incre_displacement; /**< incremental displacement */
-    vec incre_velocity;     /**< incremental velocity */
-    vec incre_acceleration; /**< incremental acceleration */
-
-    vec trial_resistance;
-    vec trial_displacement; /**< trial displacement */
-    vec trial_velocity;     /**< trial velocity */
-    vec trial_acceleration; /**< trial acceleration */
+    vec gather(const Col<double>& (Factory<double>::*)() const) const;
+    void scatter(Col<double>& (*)(const shared_ptr<Factory<double>>&), const vec&) const;
 
 public:
     explicit Node(const unsigned& = 0);
@@ -104,40 +95,20 @@ public:
     void set_trial_velocity(const vec&);
     void set_trial_acceleration(const vec&);
 
-    const vec& get_current_resistance() const;
-    const vec& get_current_displacement() const;
-    const vec& get_current_velocity() const;
-    const vec& get_current_acceleration() const;
-
-    const vec& get_incre_resistance() const;
-    const vec& get_incre_displacement() const;
-    const vec& get_incre_velocity() const;
-    const vec& get_incre_acceleration() const;
-
-    const vec& get_trial_resistance() const;
-    const vec& get_trial_displacement() const;
-    const vec& get_trial_velocity() const;
-    const vec& get_trial_acceleration() const;
-
-    void update_current_resistance(const vec&);
-    void update_incre_resistance(const vec&);
-    void update_trial_resistance(const vec&);
-
-    void update_current_status(const vec&);
-    void update_current_status(const vec&, const vec&);
-    void update_current_status(const vec&, const vec&, const vec&);
-
-    void update_incre_status(const vec&);
-    void update_incre_status(const vec&, const vec&);
-    void update_incre_status(const vec&, const vec&, const vec&);
+    vec get_current_resistance() const;
+    vec get_current_displacement() const;
+    vec get_current_velocity() const;
+    vec get_current_acceleration() const;
 
-    void update_trial_status(const vec&);
-    void update_trial_status(const vec&, const vec&);
-    void update_trial_status(const vec&, const vec&, const vec&);
+    vec get_incre_resistance() const;
+    vec get_incre_displacement() const;
+    vec get_incre_velocity() const;
+    vec get_incre_acceleration() const;
 
-    void commit_status();
-    void reset_status();
-    void clear_status();
+    vec get_trial_resistance() const;
+    vec get_trial_displacement() const;
+    vec get_trial_velocity() const;
+    vec get_trial_acceleration() const;
 
     vector<vec> record(const OutputType&) const;
 
@@ -71,6 +71,7 @@ public:
     iterator end();
 
     bool insert(const shared_ptr<T>&);
+    bool insert(const vector<shared_ptr<T>>&);
     shared_ptr<T>& operator[](const unsigned&);
     const shared_ptr<T>& at(const unsigned&) const;
 
@@ -107,6 +108,15 @@ template <typename T> bool Storage<T>::insert(const shared_ptr<T>& I) {
     return flag;
 }
 
+template <typename T> bool Storage<T>::insert(const vector<shared_ptr<T>>& I) {
+    // reserve once so that large batches do not rehash repeatedly
+    pond.reserve(pond.size() + I.size());
+    auto flag = true;
+    for(const auto& J : I)
+        if(J != nullptr && !insert(J)) flag = false;
+    return flag;
+}
+
 template <typename T> shared_ptr<T>& Storage<T>::operator[](const unsigned& L) { return pond[L]; }
 
 template <typename T> const shared_ptr<T>& Storage<T>::at(const unsigned& L) const { return pond.at(L); }
@@ -90,17 +90,10 @@ void B21H::initialize(const shared_ptr<DomainBase>& D) {
 }
 
 int B21H::update_status() {
-    const auto& node_i = node_ptr.at(0).lock();
-    const auto& node_j = node_ptr.at(1).lock();
-
-    auto& disp_i = node_i->get_trial_displacement();
-    auto& disp_j = node_j->get_trial_displacement();
-
     const auto new_length = length;
 
     // transform global deformation to local one (remove rigid body motion)
-    vec t_disp(6);
-    for(auto I = 0; I < 3; ++I) t_disp(I) = disp_i(I), t_disp(I + 3) = disp_j(I);
+    const auto t_disp = get_trial_displacement();
 
     const vec local_deformation = trans_mat * t_disp;
 
@@ -139,6 +132,14 @@ int B21H::reset_status() {
     return code;
 }
 
+void B21H::save_status(vector<vec>& D) const {
+    for(const auto& I : int_pt) I.b_section->save_status(D);
+}
+
+void B21H::load_status(vector<vec>::const_iterator& D) {
+    for(const auto& I : int_pt) I.b_section->load_status(D);
+}
+
 vector<vec> B21H::record(const OutputType& P) {
     vector<vec> output;
     output.reserve(int_pt.size() + elastic_int_pt.size());
@@ -67,6 +67,9 @@ public:
     int clear_status() override;
     int reset_status() override;
 
+    void save_status(vector<vec>&) const override;
+    void load_status(vector<vec>::const_iterator&) override;
+
     vector<vec> record(const OutputType&) override;
 
     void print() override;
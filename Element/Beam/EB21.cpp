@@ -90,11 +90,8 @@ void EB21::initialize(const shared_ptr<DomainBase>& D) {
 }
 
 int EB21::update_status() {
-    const auto& node_i = node_ptr.at(0).lock();
-    const auto& node_j = node_ptr.at(1).lock();
-
-    auto& disp_i = node_i->get_trial_displacement();
-    auto& disp_j = node_j->get_trial_displacement();
+    const auto t_disp = get_trial_displacement();
+    const vec disp_i = t_disp.head(b_dof), disp_j = t_disp.tail(b_dof);
 
     auto new_length = length;
 
@@ -105,7 +102,7 @@ int EB21::update_status() {
         disp_diff(0) = disp_j(0) - disp_i(0);
         disp_diff(1) = disp_j(1) - disp_i(1);
 
-        disp_diff += node_j->get_coordinate() - node_i->get_coordinate();
+        disp_diff += node_ptr[1].lock()->get_coordinate() - node_ptr[0].lock()->get_coordinate();
 
         new_length = norm(disp_diff);
 
@@ -155,4 +152,8 @@ int EB21::clear_status() { return b_material->clear_status(); }
 
 int EB21::reset_status() { return b_material->reset_status(); }
 
+void EB21::save_status(vector<vec>& D) const { b_material->save_status(D); }
+
+void EB21::load_status(vector<vec>::const_iterator& D) { b_material->load_status(D); }
+
 void EB21::print() { suanpan_info("An elastic B21 element%s", nlgeom ? " with corotational formulation.\n" : ".\n"); }
@@ -23,6 +23,8 @@
 #include <Toolbox/IntegrationPlan.h>
 #include <Toolbox/shapeFunction.hpp>
 #include <Toolbox/tensorToolbox.h>
+#include <Toolbox/ThreadPool.h>
+#include <Toolbox/utility.h>
 
 const unsigned F21::b_node = 2;
 const unsigned F21::b_dof = 3;
@@ -31,7 +33,47 @@ F21::IntegrationPoint::IntegrationPoint(const double C, const double W, unique_p
     : coor(C)
     , weight(W)
     , b_section(move(M))
-    , B(2, 3, fill::zeros) {}
+    , B(2, 3, fill::zeros) {
+    flexibility.zeros();
+    residual.zeros();
+}
+
+// section flexibility is diagonal, its contribution is formed entry by entry without temporaries
+int F21::IntegrationPoint::update_status(const vec3& local_resistance, const double length) {
+    const auto factor_i = B(1, 1), factor_j = B(1, 2);
+
+    const auto target_axial = local_resistance(0);
+    const auto target_moment = factor_i * local_resistance(1) + factor_j * local_resistance(2);
+
+    const auto& t_stiffness = b_section->get_stiffness();
+    const auto& t_resistance = b_section->get_resistance();
+
+    // compute unbalanced deformation
+    vec2 incre_deformation;
+    incre_deformation(0) = t_stiffness(0, 0) == 0. ? 0. : 1. / t_stiffness(0, 0) * (target_axial - t_resistance(0));
+    incre_deformation(1) = t_stiffness(1, 1) == 0. ? 0. : 1. / t_stiffness(1, 1) * (target_moment - t_resistance(1));
+
+    // update status
+    const auto code = b_section->update_trial_status(b_section->get_deformation() + incre_deformation);
+    if(code != 0) return code;
+
+    // collect new flexibility and deformation
+    const auto flexibility_a = t_stiffness(0, 0) == 0. ? 0. : weight * length / t_stiffness(0, 0);
+    const auto flexibility_b = t_stiffness(1, 1) == 0. ? 0. : weight * length / t_stiffness(1, 1);
+
+    flexibility(0, 0) = flexibility_a;
+    flexibility(1, 1) = flexibility_b * factor_i * factor_i;
+    flexibility(2, 1) = flexibility(1, 2) = flexibility_b * factor_i * factor_j;
+    flexibility(2, 2) = flexibility_b * factor_j * factor_j;
+
+    const auto residual_moment = flexibility_b * (t_resistance(1) - target_moment);
+
+    residual(0) = flexibility_a * (t_resistance(0) - target_axial);
+    residual(1) = factor_i * residual_moment;
+    residual(2) = factor_j * residual_moment;
+
+    return 0;
+}
 
 mat F21::quick_inverse(const mat& stiffness) {
     mat flexibility(stiffness.n_rows, stiffness.n_cols, fill::zeros);
@@ -42,9 +84,35 @@ mat F21::quick_inverse(const mat& stiffness) {
     return flexibility;
 }
 
-F21::F21(const unsigned& T, const uvec& N, const unsigned& S, const unsigned& P, const bool& F)
+int F21::update_section(vec3& residual_deformation) {
+    const auto n_section = int_pt.size();
+
+    auto code = 0;
+
+    if(parallel_section)
+        code = parallel_reduce(n_section, [&](const size_t I) { return int_pt[I].update_status(trial_local_resistance, length); });
+    else
+        for(auto& I : int_pt) code += I.update_status(trial_local_resistance, length);
+
+    if(code != 0) return code;
+
+    // contributions are summed in a fixed order so that the result does not depend on the number of threads
+    trial_local_flexibility.zeros();
+    residual_deformation.zeros();
+    for(const auto& I : int_pt) {
+        trial_local_flexibility += I.flexibility;
+        residual_deformation += I.residual;
+    }
+
+    return 0;
+}
+
+F21::F21(const unsigned& T, const uvec& N, const unsigned& S, const unsigned& P, const bool& F, const unsigned& MI, const double& TL, const bool& PS)
     : SectionElement(T, ET_F21, b_node, b_dof, N, uvec{ S }, F)
-    , int_pt_num(P) {}
+    , int_pt_num(P)
+    , max_iteration(std::max(1u, MI))
+    , tolerance(TL)
+    , parallel_section(PS) {}
 
 void F21::initialize(const shared_ptr<DomainBase>& D) {
     auto& coord_i = node_ptr.at(0).lock()->get_coordinate();
@@ -70,7 +138,7 @@ void F21::initialize(const shared_ptr<DomainBase>& D) {
 
     const IntegrationPlan plan(1, int_pt_num, IntegrationType::LOBATTO);
 
-    initial_local_flexibility.zeros(3, 3);
+    initial_local_flexibility.zeros();
     int_pt.clear(), int_pt.reserve(int_pt_num);
     for(unsigned I = 0; I < int_pt_num; ++I) {
         int_pt.emplace_back(plan(I, 0), .5 * plan(I, 1), section_proto->get_copy());
@@ -85,20 +153,16 @@ void F21::initialize(const shared_ptr<DomainBase>& D) {
 
     trial_local_flexibility = current_local_flexibility = initial_local_flexibility;
 
-    current_local_deformation.zeros(3);
-    trial_local_deformation.zeros(3);
-    current_local_resistance.zeros(3);
-    trial_local_resistance.zeros(3);
+    current_local_deformation.zeros();
+    trial_local_deformation.zeros();
+    current_local_resistance.zeros();
+    trial_local_resistance.zeros();
 }
 
 int F21::update_status() {
-    auto& disp_i = node_ptr.at(0).lock()->get_trial_displacement();
-    auto& disp_j = node_ptr.at(1).lock()->get_trial_displacement();
-
-    vec t_disp(6);
-    for(auto I = 0; I < 3; ++I) t_disp(I) = disp_i(I), t_disp(I + 3) = disp_j(I);
+    const auto t_disp = get_trial_displacement();
 
-    vec residual_deformation = -trial_local_deformation;
+    vec3 residual_deformation = -trial_local_deformation;
 
     // transform global deformation to local one (remove rigid body motion)
     trial_local_deformation = trans_mat * t_disp;
@@ -106,28 +170,17 @@ int F21::update_status() {
     // initial residual be aware of how to compute it
     residual_deformation += trial_local_deformation;
 
-    const auto new_length = length;
-
-    auto counter = 0;
+    unsigned counter = 0;
     while(true) {
         trial_local_resistance += solve(trial_local_flexibility, residual_deformation);
-        residual_deformation.zeros();
-        trial_local_flexibility.zeros();
-        for(const auto& I : int_pt) {
-            const vec target_section_resistance = I.B * trial_local_resistance;
-            // compute unbalanced deformation
-            const vec incre_deformation = quick_inverse(I.b_section->get_stiffness()) * (target_section_resistance - I.b_section->get_resistance());
-            // update status
-            I.b_section->update_trial_status(I.b_section->get_deformation() + incre_deformation);
-            // collect new flexibility and deformation
-            const mat t_flexibility = I.B.t() * quick_inverse(I.b_section->get_stiffness()) * I.weight * new_length;
-            trial_local_flexibility += t_flexibility * I.B;
-            residual_deformation += t_flexibility * (I.b_section->get_resistance() - target_section_resistance);
+        ++trial_iteration;
+        if(update_section(residual_deformation) != 0) {
+            suanpan_extra_debug("section state determination fails at element level.\n");
+            return -1;
         }
         // quit if converged
-        if(norm(residual_deformation) < 1E-12) break;
-        // impose a relatively more strict rule
-        if(++counter > 5) {
+        if(norm(residual_deformation) < tolerance) break;
+        if(++counter >= max_iteration) {
             suanpan_extra_debug("iteration fails to converge at element level.\n");
             return -1;
         }
@@ -140,6 +193,7 @@ int F21::update_status() {
 }
 
 int F21::clear_status() {
+    current_iteration = trial_iteration = 0;
     trial_local_flexibility = current_local_flexibility = initial_local_flexibility;
     current_local_deformation.zeros();
     trial_local_deformation.zeros();
@@ -151,6 +205,8 @@ int F21::clear_status() {
 }
 
 int F21::commit_status() {
+    current_iteration = trial_iteration;
+    trial_iteration = 0;
     current_local_flexibility = trial_local_flexibility;
     current_local_deformation = trial_local_deformation;
     current_local_resistance = trial_local_resistance;
@@ -160,6 +216,7 @@ int F21::commit_status() {
 }
 
 int F21::reset_status() {
+    trial_iteration = 0;
     trial_local_flexibility = current_local_flexibility;
     trial_local_deformation = current_local_deformation;
     trial_local_resistance = current_local_resistance;
@@ -168,6 +225,20 @@ int F21::reset_status() {
     return code;
 }
 
+void F21::save_status(vector<vec>& D) const {
+    D.emplace_back(vectorise(current_local_flexibility));
+    D.emplace_back(current_local_deformation);
+    D.emplace_back(current_local_resistance);
+    for(const auto& I : int_pt) I.b_section->save_status(D);
+}
+
+void F21::load_status(vector<vec>::const_iterator& D) {
+    current_local_flexibility = reshape(*D++, size(current_local_flexibility));
+    current_local_deformation = *D++;
+    current_local_resistance = *D++;
+    for(const auto& I : int_pt) I.b_section->load_status(D);
+}
+
 vector<vec> F21::record(const OutputType& P) {
     vector<vec> output;
     output.reserve(int_pt.size());
@@ -178,6 +249,8 @@ vector<vec> F21::record(const OutputType& P) {
         for(const auto& I : int_pt) output.emplace_back(I.b_section->get_resistance());
     else if(P == OutputType::PE)
         for(const auto& I : int_pt) output.emplace_back(I.b_section->get_deformation() - I.b_section->get_resistance() / I.b_section->get_initial_stiffness().diag());
+    else if(P == OutputType::ITER)
+        output.emplace_back(vec{ double(current_iteration) });
 
     return output;
 }
@@ -23,6 +23,8 @@
 #include <Toolbox/IntegrationPlan.h>
 #include <Toolbox/shapeFunction.hpp>
 #include <Toolbox/tensorToolbox.h>
+#include <Toolbox/ThreadPool.h>
+#include <Toolbox/utility.h>
 
 const unsigned F21H::b_node = 2;
 const unsigned F21H::b_dof = 3;
@@ -33,6 +35,56 @@ F21H::IntegrationPoint::IntegrationPoint(const double C, const double W, unique_
     , b_section(move(M))
     , B(2, 3, fill::zeros) {
     B(0, 0) = 1.;
+    flexibility.zeros();
+    residual.zeros();
+}
+
+// section flexibility is diagonal, its contribution is formed entry by entry without temporaries
+int F21H::IntegrationPoint::update_status(const vec3& local_resistance, const double length) {
+    const auto factor_i = B(1, 1), factor_j = B(1, 2);
+
+    const auto target_axial = local_resistance(0);
+    const auto target_moment = factor_i * local_resistance(1) + factor_j * local_resistance(2);
+
+    const auto& t_stiffness = b_section->get_stiffness();
+    const auto& t_resistance = b_section->get_resistance();
+
+    // compute unbalanced deformation use section stiffness
+    vec2 incre_deformation;
+    incre_deformation(0) = (target_axial - t_resistance(0)) / t_stiffness(0, 0);
+    incre_deformation(1) = (target_moment - t_resistance(1)) / t_stiffness(1, 1);
+
+    // update status
+    const auto code = b_section->update_trial_status(b_section->get_deformation() + incre_deformation);
+    if(code != 0) return code;
+
+    // collect new flexibility and deformation
+    const auto flexibility_a = t_stiffness(0, 0) == 0. ? 0. : weight * length / t_stiffness(0, 0);
+    const auto flexibility_b = t_stiffness(1, 1) == 0. ? 0. : weight * length / t_stiffness(1, 1);
+
+    flexibility(0, 0) = flexibility_a;
+    flexibility(1, 1) = flexibility_b * factor_i * factor_i;
+    flexibility(2, 1) = flexibility(1, 2) = flexibility_b * factor_i * factor_j;
+    flexibility(2, 2) = flexibility_b * factor_j * factor_j;
+
+    const auto residual_moment = flexibility_b * (t_resistance(1) - target_moment);
+
+    residual(0) = flexibility_a * (t_resistance(0) - target_axial);
+    residual(1) = factor_i * residual_moment;
+    residual(2) = factor_j * residual_moment;
+
+    return 0;
+}
+
+// elastic interior only tracks deformation with initial section flexibility, no residual is generated
+int F21H::IntegrationPoint::update_elastic_status(const vec3& local_resistance, const mat& section_flexibility) const {
+    const auto& t_resistance = b_section->get_resistance();
+
+    vec2 incre_deformation;
+    incre_deformation(0) = (local_resistance(0) - t_resistance(0)) * section_flexibility(0, 0);
+    incre_deformation(1) = (B(1, 1) * local_resistance(1) + B(1, 2) * local_resistance(2) - t_resistance(1)) * section_flexibility(1, 1);
+
+    return b_section->update_trial_status(b_section->get_deformation() + incre_deformation);
 }
 
 mat F21H::quick_inverse(const mat& stiffness) {
@@ -44,9 +96,39 @@ mat F21H::quick_inverse(const mat& stiffness) {
     return flexibility;
 }
 
-F21H::F21H(const unsigned T, const uvec& N, const unsigned S, const double L, const bool F)
+int F21H::update_section(vec3& residual_deformation) {
+    const auto n_hinge = int_pt.size();
+    const auto n_section = n_hinge + elastic_int_pt.size();
+
+    // hinges come first, followed by the elastic interior
+    const auto t_update = [&](const size_t I) { return I < n_hinge ? int_pt[I].update_status(trial_local_resistance, length) : elastic_int_pt[I - n_hinge].update_elastic_status(trial_local_resistance, elastic_section_flexibility); };
+
+    auto code = 0;
+
+    if(parallel_section)
+        code = parallel_reduce(n_section, t_update);
+    else
+        for(size_t I = 0; I < n_section; ++I) code += t_update(I);
+
+    if(code != 0) return code;
+
+    // contributions are summed in a fixed order so that the result does not depend on the number of threads
+    trial_local_flexibility = elastic_local_flexibility;
+    residual_deformation.zeros();
+    for(const auto& I : int_pt) {
+        trial_local_flexibility += I.flexibility;
+        residual_deformation += I.residual;
+    }
+
+    return 0;
+}
+
+F21H::F21H(const unsigned T, const uvec& N, const unsigned S, const double L, const bool F, const unsigned MI, const double TL, const bool PS)
     : SectionElement(T, ET_F21H, b_node, b_dof, N, uvec{ S }, F)
-    , hinge_length(L > .5 ? .5 : L) {}
+    , hinge_length(L > .5 ? .5 : L)
+    , max_iteration(std::max(1u, MI))
+    , tolerance(TL)
+    , parallel_section(PS) {}
 
 void F21H::initialize(const shared_ptr<DomainBase>& D) {
     auto& coord_i = node_ptr.at(0).lock()->get_coordinate();
@@ -76,7 +158,7 @@ void F21H::initialize(const shared_ptr<DomainBase>& D) {
     const auto int_pt_num = plan.n_rows + 2;
     const auto elastic_length = 1. - 8. * hinge_length;
     // elastic part will be reused in computation
-    elastic_local_flexibility.zeros(3, 3);
+    elastic_local_flexibility.zeros();
     // build up the elastic interior
     elastic_int_pt.clear(), elastic_int_pt.reserve(int_pt_num);
     for(unsigned I = 0; I < int_pt_num; ++I) {
@@ -116,57 +198,32 @@ void F21H::initialize(const shared_ptr<DomainBase>& D) {
 
     trial_local_flexibility = current_local_flexibility = initial_local_flexibility;
 
-    current_local_deformation.zeros(3);
-    trial_local_deformation.zeros(3);
-    current_local_resistance.zeros(3);
-    trial_local_resistance.zeros(3);
+    current_local_deformation.zeros();
+    trial_local_deformation.zeros();
+    current_local_resistance.zeros();
+    trial_local_resistance.zeros();
 }
 
 int F21H::update_status() {
-    auto& disp_i = node_ptr.at(0).lock()->get_trial_displacement();
-    auto& disp_j = node_ptr.at(1).lock()->get_trial_displacement();
-
-    vec t_disp(6);
-    for(auto I = 0; I < 3; ++I) t_disp(I) = disp_i(I), t_disp(I + 3) = disp_j(I);
+    const auto t_disp = get_trial_displacement();
 
-    vec residual_deformation = -trial_local_deformation;
+    vec3 residual_deformation = -trial_local_deformation;
     // transform global deformation to local one (remove rigid body motion)
     trial_local_deformation = trans_mat * t_disp;
     // initial residual be aware of how to compute it
     residual_deformation += trial_local_deformation;
 
-    const auto new_length = length;
-
-    auto counter = 0;
+    unsigned counter = 0;
     while(true) {
         trial_local_resistance += solve(trial_local_flexibility, residual_deformation);
-        residual_deformation.zeros();
-        // consider elastic interior no residual generated
-        trial_local_flexibility = elastic_local_flexibility;
-        // computation of hinge part
-        for(const auto& I : int_pt) {
-            const vec target_section_resistance = I.B * trial_local_resistance;
-            // compute unbalanced deformation use section stiffness
-            const vec incre_deformation = (target_section_resistance - I.b_section->get_resistance()) / I.b_section->get_stiffness().diag();
-            // update status
-            I.b_section->update_trial_status(I.b_section->get_deformation() + incre_deformation);
-            // collect new flexibility and deformation
-            const mat t_flexibility = I.B.t() * quick_inverse(I.b_section->get_stiffness()) * I.weight * new_length;
-            trial_local_flexibility += t_flexibility * I.B;
-            residual_deformation += t_flexibility * (I.b_section->get_resistance() - target_section_resistance);
-        }
-        // computation of elastic part
-        // only for deformation tracking no necessary for response
-        for(const auto& I : elastic_int_pt) {
-            // compute unbalanced deformation use initial section stiffness
-            const vec incre_deformation = (I.B * trial_local_resistance - I.b_section->get_resistance()) % elastic_section_flexibility.diag();
-            // update status
-            I.b_section->update_trial_status(I.b_section->get_deformation() + incre_deformation);
+        ++trial_iteration;
+        if(update_section(residual_deformation) != 0) {
+            suanpan_extra_debug("section state determination fails at element level.\n");
+            return -1;
         }
         // quit if converged
-        if(norm(residual_deformation) < 1E-12) break;
-        // impose a relatively more strict rule
-        if(++counter > 5) {
+        if(norm(residual_deformation) < tolerance) break;
+        if(++counter >= max_iteration) {
             suanpan_extra_debug("iteration fails to converge at element level.\n");
             return -1;
         }
@@ -179,6 +236,7 @@ int F21H::update_status() {
 }
 
 int F21H::clear_status() {
+    current_iteration = trial_iteration = 0;
     trial_local_flexibility = current_local_flexibility = initial_local_flexibility;
     current_local_deformation.zeros();
     trial_local_deformation.zeros();
@@ -190,6 +248,8 @@ int F21H::clear_status() {
 }
 
 int F21H::commit_status() {
+    current_iteration = trial_iteration;
+    trial_iteration = 0;
     current_local_flexibility = trial_local_flexibility;
     current_local_deformation = trial_local_deformation;
     current_local_resistance = trial_local_resistance;
@@ -199,6 +259,7 @@ int F21H::commit_status() {
 }
 
 int F21H::reset_status() {
+    trial_iteration = 0;
     trial_local_flexibility = current_local_flexibility;
     trial_local_deformation = current_local_deformation;
     trial_local_resistance = current_local_resistance;
@@ -207,6 +268,20 @@ int F21H::reset_status() {
     return code;
 }
 
+void F21H::save_status(vector<vec>& D) const {
+    D.emplace_back(vectorise(current_local_flexibility));
+    D.emplace_back(current_local_deformation);
+    D.emplace_back(current_local_resistance);
+    for(const auto& I : int_pt) I.b_section->save_status(D);
+}
+
+void F21H::load_status(vector<vec>::const_iterator& D) {
+    current_local_flexibility = reshape(*D++, size(current_local_flexibility));
+    current_local_deformation = *D++;
+    current_local_resistance = *D++;
+    for(const auto& I : int_pt) I.b_section->load_status(D);
+}
+
 vector<vec> F21H::record(const OutputType& P) {
     vector<vec> output;
     output.reserve(int_pt.size() + elastic_int_pt.size());
@@ -230,6 +305,8 @@ vector<vec> F21H::record(const OutputType& P) {
         output.emplace_back(int_pt[2].b_section->get_deformation() - int_pt[2].b_section->get_resistance() / int_pt[2].b_section->get_initial_stiffness().diag());
         output.emplace_back(int_pt[3].b_section->get_deformation() - int_pt[3].b_section->get_resistance() / int_pt[3].b_section->get_initial_stiffness().diag());
     }
+    else if(P == OutputType::ITER)
+        output.emplace_back(vec{ double(current_iteration) });
 
     return output;
 }
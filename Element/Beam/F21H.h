@@ -40,29 +40,46 @@ class F21H final : public SectionElement {
 
     vec direction_cosine; /**< direction cosine */
 
+    const unsigned max_iteration; /**< maximum number of local iterations */
+    const double tolerance;       /**< tolerance of residual deformation */
+    const bool parallel_section;  /**< switch to update sections concurrently */
+
+    unsigned current_iteration = 0, trial_iteration = 0; /**< number of local iterations */
+
     struct IntegrationPoint {
         double coor, weight;
         unique_ptr<Section> b_section;
         mat B;
+        mat33 flexibility;
+        vec3 residual;
         IntegrationPoint(const double, const double, unique_ptr<Section>&&);
+        int update_status(const vec3&, const double);
+        int update_elastic_status(const vec3&, const mat&) const;
     };
 
     vector<IntegrationPoint> int_pt, elastic_int_pt;
 
-    mat trans_mat, initial_local_flexibility, elastic_local_flexibility, elastic_section_flexibility;
+    mat trans_mat, elastic_section_flexibility;
+
+    mat33 initial_local_flexibility, elastic_local_flexibility;
 
-    mat current_local_flexibility, trial_local_flexibility;
-    vec current_local_deformation, trial_local_deformation;
-    vec current_local_resistance, trial_local_resistance;
+    mat33 current_local_flexibility, trial_local_flexibility;
+    vec3 current_local_deformation, trial_local_deformation;
+    vec3 current_local_resistance, trial_local_resistance;
 
     static mat quick_inverse(const mat&);
 
+    int update_section(vec3&);
+
 public:
-    F21H(const unsigned,   // tag
-        const uvec&,       // node tags
-        const unsigned,    // section tags
-        const double = .2, // hinge length
-        const bool = false // nonliear geometry switch
+    F21H(const unsigned,      // tag
+        const uvec&,          // node tags
+        const unsigned,       // section tags
+        const double = .2,    // hinge length
+        const bool = false,   // nonliear geometry switch
+        const unsigned = 6,   // maximum local iterations
+        const double = 1E-12, // local tolerance
+        const bool = false    // parallel section update switch
     );
 
     void initialize(const shared_ptr<DomainBase>&) override;
@@ -73,6 +90,9 @@ public:
     int commit_status() override;
     int reset_status() override;
 
+    void save_status(vector<vec>&) const override;
+    void load_status(vector<vec>::const_iterator&) override;
+
     vector<vec> record(const OutputType&) override;
 
     void print() override;
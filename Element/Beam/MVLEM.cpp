@@ -92,3 +92,21 @@ int MVLEM::reset_status() {
 
     return code;
 }
+
+void MVLEM::save_status(vector<vec>& D) const {
+    shear_spring->save_status(D);
+
+    for(const auto& I : axial_spring) {
+        I.c_material->save_status(D);
+        I.s_material->save_status(D);
+    }
+}
+
+void MVLEM::load_status(vector<vec>::const_iterator& D) {
+    shear_spring->load_status(D);
+
+    for(const auto& I : axial_spring) {
+        I.c_material->load_status(D);
+        I.s_material->load_status(D);
+    }
+}
@@ -83,13 +83,9 @@ void C3D20::initialize(const shared_ptr<DomainBase>& D) {
 }
 
 int C3D20::update_status() {
-    auto code = 0, idx = 0;
+    auto code = 0;
 
-    vec t_disp(c_size);
-    for(const auto& I : node_ptr) {
-        const auto& tmp_disp = I.lock()->get_trial_displacement();
-        for(auto J = 0; J < c_dof; ++J) t_disp(idx++) = tmp_disp(J);
-    }
+    const auto t_disp = get_trial_displacement();
 
     trial_stiffness.zeros(c_size, c_size);
     trial_resistance.zeros(c_size);
@@ -121,4 +117,12 @@ int C3D20::reset_status() {
     return code;
 }
 
+void C3D20::save_status(vector<vec>& D) const {
+    for(const auto& I : int_pt) I.c_material->save_status(D);
+}
+
+void C3D20::load_status(vector<vec>::const_iterator& D) {
+    for(const auto& I : int_pt) I.c_material->load_status(D);
+}
+
 void C3D20::print() { suanpan_info("C3D20(R) element.\n"); }
@@ -26,11 +26,10 @@ const unsigned C3D8::c_node = 8;
 const unsigned C3D8::c_dof = 3;
 const unsigned C3D8::c_size = c_dof * c_node;
 
-C3D8::IntegrationPoint::IntegrationPoint(const vec& C, const double W, const double J, unique_ptr<Material>&& M, const mat& PNPXY)
+C3D8::IntegrationPoint::IntegrationPoint(const vec& C, const double W, const double J, const mat& PNPXY)
     : coor(C)
     , weight(W)
     , jacob_det(J)
-    , c_material(move(M))
     , pn_pxy(PNPXY) {}
 
 C3D8::C3D8(const unsigned T, const uvec& N, const unsigned M, const bool R, const bool F)
@@ -53,9 +52,11 @@ void C3D8::initialize(const shared_ptr<DomainBase>& D) {
         const vec t_vec(std::initializer_list<double>{ plan(I, 0), plan(I, 1), plan(I, 2) });
         const auto pn = shape::cube(t_vec, 1);
         const mat jacob = pn * ele_coor;
-        int_pt.emplace_back(t_vec, plan(I, c_dof), det(jacob), material_proto->get_copy(), solve(jacob, pn));
+        int_pt.emplace_back(t_vec, plan(I, c_dof), det(jacob), solve(jacob, pn));
     }
 
+    c_material = material_proto->get_batch(plan.n_rows);
+
     initial_mass.zeros(c_size, c_size);
     const auto t_density = material_proto->get_parameter();
     if(t_density != 0.) {
@@ -74,29 +75,34 @@ void C3D8::initialize(const shared_ptr<DomainBase>& D) {
 }
 
 int C3D8::update_status() {
-    auto code = 0;
+    const mat ele_disp = reshape(get_trial_displacement(), c_dof, c_node);
 
-    vec t_strain(6);
+    mat t_strain(6, int_pt.size(), fill::zeros);
 
-    trial_stiffness.zeros(c_size, c_size);
-    trial_resistance.zeros(c_size);
-    for(const auto& I : int_pt) {
-        t_strain.zeros();
+    for(unsigned K = 0; K < int_pt.size(); ++K) {
+        const auto& I = int_pt[K];
         for(auto J = 0; J < c_node; ++J) {
-            const auto& t_disp = node_ptr[J].lock()->get_trial_displacement();
-            t_strain(0) += t_disp(0) * I.pn_pxy(0, J);
-            t_strain(1) += t_disp(1) * I.pn_pxy(1, J);
-            t_strain(2) += t_disp(2) * I.pn_pxy(2, J);
-            t_strain(3) += t_disp(0) * I.pn_pxy(1, J) + t_disp(1) * I.pn_pxy(0, J);
-            t_strain(4) += t_disp(1) * I.pn_pxy(2, J) + t_disp(2) * I.pn_pxy(1, J);
-            t_strain(5) += t_disp(0) * I.pn_pxy(2, J) + t_disp(2) * I.pn_pxy(0, J);
+            t_strain(0, K) += ele_disp(0, J) * I.pn_pxy(0, J);
+            t_strain(1, K) += ele_disp(1, J) * I.pn_pxy(1, J);
+            t_strain(2, K) += ele_disp(2, J) * I.pn_pxy(2, J);
+            t_strain(3, K) += ele_disp(0, J) * I.pn_pxy(1, J) + ele_disp(1, J) * I.pn_pxy(0, J);
+            t_strain(4, K) += ele_disp(1, J) * I.pn_pxy(2, J) + ele_disp(2, J) * I.pn_pxy(1, J);
+            t_strain(5, K) += ele_disp(0, J) * I.pn_pxy(2, J) + ele_disp(2, J) * I.pn_pxy(0, J);
         }
-        code += I.c_material->update_trial_status(t_strain);
+    }
+
+    // all integration points are updated in one call
+    const auto code = c_material->update_trial_status(t_strain);
+
+    trial_stiffness.zeros(c_size, c_size);
+    trial_resistance.zeros(c_size);
+    for(unsigned K = 0; K < int_pt.size(); ++K) {
+        const auto& I = int_pt[K];
 
         const auto t_factor = I.jacob_det * I.weight;
 
-        auto& t_stiff = I.c_material->get_stiffness();
-        auto& t_stress = I.c_material->get_stress();
+        const mat66 t_stiff(c_material->get_stiffness().colptr(K));
+        const vec6 t_stress(c_material->get_stress().colptr(K));
 
         const auto& NX1 = I.pn_pxy(0, 0);
         const auto& NY1 = I.pn_pxy(1, 0);
@@ -983,22 +989,14 @@ int C3D8::update_status() {
     return code;
 }
 
-int C3D8::commit_status() {
-    auto code = 0;
-    for(const auto& I : int_pt) code += I.c_material->commit_status();
-    return code;
-}
+int C3D8::commit_status() { return c_material->commit_status(); }
 
-int C3D8::clear_status() {
-    auto code = 0;
-    for(const auto& I : int_pt) code += I.c_material->clear_status();
-    return code;
-}
+int C3D8::clear_status() { return c_material->clear_status(); }
 
-int C3D8::reset_status() {
-    auto code = 0;
-    for(const auto& I : int_pt) code += I.c_material->reset_status();
-    return code;
-}
+int C3D8::reset_status() { return c_material->reset_status(); }
+
+void C3D8::save_status(vector<vec>& D) const { c_material->save_status(D); }
+
+void C3D8::load_status(vector<vec>::const_iterator& D) { c_material->load_status(D); }
 
 void C3D8::print() { suanpan_info("C3D8(R) element.\n"); }
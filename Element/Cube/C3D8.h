@@ -30,14 +30,14 @@
 #define C3D8_H
 
 #include <Element/MaterialElement.h>
+#include <Material/MaterialBatch.h>
 
 class C3D8 final : public MaterialElement {
     struct IntegrationPoint {
-        vec coor;
+        vec3 coor;
         double weight, jacob_det;
-        unique_ptr<Material> c_material;
-        mat pn_pxy;
-        IntegrationPoint(const vec&, const double, const double, unique_ptr<Material>&&, const mat&);
+        mat::fixed<3, 8> pn_pxy;
+        IntegrationPoint(const vec&, const double, const double, const mat&);
     };
 
     static const unsigned c_node, c_dof, c_size;
@@ -46,6 +46,8 @@ class C3D8 final : public MaterialElement {
 
     vector<IntegrationPoint> int_pt;
 
+    unique_ptr<MaterialBatch> c_material; /**< materials of all integration points */
+
 public:
     C3D8(const unsigned,     // tag
         const uvec&,         // node tags
@@ -61,6 +63,9 @@ public:
     int clear_status() override;
     int reset_status() override;
 
+    void save_status(vector<vec>&) const override;
+    void load_status(vector<vec>::const_iterator&) override;
+
     void print() override;
 };
 
@@ -90,13 +90,9 @@ void C3D8::initialize(const shared_ptr<Domain>& D) {
 }
 
 int C3D8::update_status() {
-    auto code = 0, idx = 0;
+    auto code = 0;
 
-    vec t_disp(24);
-    for(const auto& I : node_ptr) {
-        const auto& tmp_disp = I.lock()->get_trial_displacement();
-        for(auto J = 0; J < c_dof; ++J) t_disp(idx++) = tmp_disp(J);
-    }
+    const auto t_disp = get_trial_displacement();
 
     stiffness.zeros();
     resistance.zeros();
@@ -17,7 +17,9 @@
 
 #include "Element.h"
 #include <Domain/DomainBase.h>
+#include <Domain/Factory.hpp>
 #include <Domain/Node.h>
+#include <Element/Utility/MatrixModifier.h>
 #include <Material/Material.h>
 #include <Section/Section.h>
 
@@ -46,6 +48,8 @@ Element::Element(const unsigned T, const unsigned CT, const unsigned NN, const u
 Element::~Element() { suanpan_debug("Element %u dtor() called.\n", get_tag()); }
 
 void Element::initialize(const shared_ptr<DomainBase>& D) {
+    factory = D->get_factory();
+
     // initialized before check node vadality
     if(node_ptr.size() == num_node) {
         for(const auto& I : node_ptr) {
@@ -54,6 +58,8 @@ void Element::initialize(const shared_ptr<DomainBase>& D) {
                 D->disable_element(get_tag());
                 return;
             }
+            // dof numbers are reset before each initialization
+            if(t_node->get_dof_number() < num_dof) t_node->set_dof_number(num_dof);
         }
         return;
     }
@@ -103,6 +109,26 @@ void Element::initialize(const shared_ptr<DomainBase>& D) {
     }
 }
 
+vec Element::gather(const Col<double>& (Factory<double>::*F)() const) const {
+    if(factory != nullptr && !dof_encoding.is_empty()) {
+        const auto& t_state = (*factory.*F)();
+        if(dof_encoding.max() < t_state.n_elem) return t_state(dof_encoding);
+    }
+    return zeros<vec>(dof_encoding.n_elem);
+}
+
+vec Element::get_trial_displacement() const { return gather(&Factory<double>::get_trial_displacement); }
+
+vec Element::get_trial_velocity() const { return gather(&Factory<double>::get_trial_velocity); }
+
+vec Element::get_trial_acceleration() const { return gather(&Factory<double>::get_trial_acceleration); }
+
+vec Element::get_current_displacement() const { return gather(&Factory<double>::get_current_displacement); }
+
+vec Element::get_current_velocity() const { return gather(&Factory<double>::get_current_velocity); }
+
+vec Element::get_current_acceleration() const { return gather(&Factory<double>::get_current_acceleration); }
+
 void Element::update_dof_encoding() {
     auto idx = 0;
     for(const auto& tmp_ptr : node_ptr) {
@@ -119,6 +145,10 @@ const uvec& Element::get_dof_encoding() const { return dof_encoding; }
 
 const uvec& Element::get_node_encoding() const { return node_encoding; }
 
+const uvec& Element::get_material_tag() const { return material_tag; }
+
+const uvec& Element::get_section_tag() const { return section_tag; }
+
 const vector<weak_ptr<Node>>& Element::get_node_ptr() const { return node_ptr; }
 
 const vec& Element::get_resistance() const { return trial_resistance; }
@@ -139,6 +169,28 @@ const mat& Element::get_initial_stiffness() const { return initial_stiffness; }
 
 const mat& Element::get_initial_geometry() const { return initial_geometry; }
 
+/**
+ * \brief Method to get the diagonal of the lumped mass matrix.
+ * \param S lumping scheme
+ * \return diagonal entries, empty if the element has no mass
+ */
+vec Element::get_lumped_mass(const LumpingScheme& S) const {
+    auto t_mass = get_mass();
+
+    if(t_mass.is_empty()) return {};
+
+    if(S == LumpingScheme::ROWSUM)
+        suanpan::mass::lumped_simple::apply(t_mass);
+    else
+        suanpan::mass::lumped_scale::apply(t_mass, num_dof);
+
+    return t_mass.diag();
+}
+
+const bool& Element::is_mass_constant() const { return constant_mass; }
+
+const bool& Element::is_damping_constant() const { return constant_damping; }
+
 int Element::update_status() { throw invalid_argument("hidden method called.\n"); }
 
 int Element::clear_status() {
@@ -174,3 +226,7 @@ int Element::reset_status() {
 }
 
 vector<vec> Element::record(const OutputType&) { return {}; }
+
+void Element::save_status(vector<vec>&) const {}
+
+void Element::load_status(vector<vec>::const_iterator&) {}
@@ -17,6 +17,9 @@
 /**
  * @class Element
  * @brief A Element class.
+ *
+ * Derived elements should obtain nodal status via the protected getters, which gather the element vector from the global storage by the DoF encoding in one pass. Locking Node objects in update_status() is costly once elements are updated in parallel.
+ *
  * @author T
  * @date 21/07/2017
  * @version 0.1.0
@@ -35,12 +38,19 @@ class DomainBase;
 enum class OutputType;
 class Material;
 class Section;
+template <typename T> class Factory;
 
 using std::vector;
 
+enum class LumpingScheme { HRZ, ROWSUM };
+
 class Element : public Tag {
     const unsigned num_node; /**< number of nodes */
     const unsigned num_dof;  /**< number of DoFs */
+
+    shared_ptr<Factory<double>> factory; /**< global status */
+
+    vec gather(const Col<double>& (Factory<double>::*)() const) const;
 protected:
     const uvec node_encoding; /**< node encoding */
     const uvec material_tag;  /**< material tags */
@@ -48,10 +58,21 @@ protected:
 
     const bool nlgeom = false; /**< nonlinear geometry switch */
 
+    bool constant_mass = true;    /**< mass matrix does not change during analysis */
+    bool constant_damping = true; /**< damping matrix does not change during analysis */
+
     uvec dof_encoding; /**< DoF encoding vector */
 
     vector<weak_ptr<Node>> node_ptr; /**< node pointers */
 
+    vec get_trial_displacement() const;
+    vec get_trial_velocity() const;
+    vec get_trial_acceleration() const;
+
+    vec get_current_displacement() const;
+    vec get_current_velocity() const;
+    vec get_current_acceleration() const;
+
     mat initial_mass;      /**< mass matrix */
     mat initial_damping;   /**< damping matrix */
     mat initial_stiffness; /**< stiffness matrix */
@@ -96,6 +117,8 @@ public:
     const unsigned& get_node_number() const;
     const uvec& get_dof_encoding() const;
     const uvec& get_node_encoding() const;
+    const uvec& get_material_tag() const;
+    const uvec& get_section_tag() const;
 
     const vector<weak_ptr<Node>>& get_node_ptr() const;
 
@@ -111,12 +134,20 @@ public:
     virtual const mat& get_initial_stiffness() const;
     virtual const mat& get_initial_geometry() const;
 
+    vec get_lumped_mass(const LumpingScheme&) const;
+
+    const bool& is_mass_constant() const;
+    const bool& is_damping_constant() const;
+
     virtual int update_status() = 0;
     virtual int clear_status() = 0;
     virtual int commit_status() = 0;
     virtual int reset_status() = 0;
 
     virtual vector<vec> record(const OutputType&);
+
+    virtual void save_status(vector<vec>&) const;
+    virtual void load_status(vector<vec>::const_iterator&);
 };
 
 #endif
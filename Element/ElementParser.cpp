@@ -18,7 +18,9 @@
 #include <Domain/DomainBase.h>
 #include <Domain/ExternalModule.h>
 #include <Element/Element>
+#include <Toolbox/ThreadPool.h>
 #include <Toolbox/utility.h>
+#include <algorithm>
 
 using std::vector;
 
@@ -31,67 +33,104 @@ int create_new_element(const shared_ptr<DomainBase>& domain, istringstream& comm
 
     unique_ptr<Element> new_element = nullptr;
 
+    if(!new_element_object(new_element, element_id, command)) {
+        // check if the library is already loaded
+        auto code = 0;
+        for(const auto& I : domain->get_external_module_pool())
+            if(I->library_name == element_id) {
+                code = 1;
+                break;
+            }
+
+        // not loaded then try load it
+        if(code == 0 && domain->insert(make_shared<ExternalModule>(element_id))) code = 1;
+
+        // if loaded find corresponding function
+        if(code == 1)
+            for(const auto& I : domain->get_external_module_pool()) {
+                if(I->locate_module(element_id)) I->new_object(new_element, command);
+                if(new_element != nullptr) break;
+            }
+    }
+
+    if(new_element == nullptr || !domain->insert(move(new_element))) suanpan_error("create_new_element() fails to create new element.\n");
+
+    return 0;
+}
+
+bool new_element_object(unique_ptr<Element>& return_obj, const string& element_id, istringstream& command) {
     if(is_equal(element_id, "CP3"))
-        new_cp3(new_element, command);
+        new_cp3(return_obj, command);
     else if(is_equal(element_id, "CP4"))
-        new_cp4(new_element, command);
+        new_cp4(return_obj, command);
     else if(is_equal(element_id, "CP6"))
-        new_cp6(new_element, command);
+        new_cp6(return_obj, command);
     else if(is_equal(element_id, "CP4R"))
-        new_cp4r(new_element, command);
+        new_cp4r(return_obj, command);
     else if(is_equal(element_id, "CP8"))
-        new_cp8(new_element, command);
+        new_cp8(return_obj, command);
     else if(is_equal(element_id, "C3D8"))
-        new_c3d8(new_element, command);
+        new_c3d8(return_obj, command);
     else if(is_equal(element_id, "C3D20"))
-        new_c3d20(new_element, command);
+        new_c3d20(return_obj, command);
     else if(is_equal(element_id, "PS"))
-        new_ps(new_element, command);
+        new_ps(return_obj, command);
     else if(is_equal(element_id, "QE2"))
-        new_qe2(new_element, command);
+        new_qe2(return_obj, command);
     else if(is_equal(element_id, "GQ12"))
-        new_gq12(new_element, command);
+        new_gq12(return_obj, command);
     else if(is_equal(element_id, "T2D2"))
-        new_t2d2(new_element, command);
+        new_t2d2(return_obj, command);
     else if(is_equal(element_id, "EB21"))
-        new_eb21(new_element, command);
+        new_eb21(return_obj, command);
     else if(is_equal(element_id, "B21"))
-        new_b21(new_element, command);
+        new_b21(return_obj, command);
     else if(is_equal(element_id, "B21H"))
-        new_b21h(new_element, command);
+        new_b21h(return_obj, command);
     else if(is_equal(element_id, "F21"))
-        new_f21(new_element, command);
+        new_f21(return_obj, command);
     else if(is_equal(element_id, "F21H"))
-        new_f21h(new_element, command);
+        new_f21h(return_obj, command);
     else if(is_equal(element_id, "Proto01"))
-        new_proto01(new_element, command);
+        new_proto01(return_obj, command);
     else if(is_equal(element_id, "Mass"))
-        new_mass(new_element, command);
+        new_mass(return_obj, command);
     else if(is_equal(element_id, "Damper01"))
-        new_damper01(new_element, command);
+        new_damper01(return_obj, command);
     else if(is_equal(element_id, "SingleSection"))
-        new_singlesection(new_element, command);
-    else {
-        // check if the library is already loaded
-        auto code = 0;
-        for(const auto& I : domain->get_external_module_pool())
-            if(I->library_name == element_id) {
-                code = 1;
-                break;
-            }
+        new_singlesection(return_obj, command);
+    else
+        return false;
 
-        // not loaded then try load it
-        if(code == 0 && domain->insert(make_shared<ExternalModule>(element_id))) code = 1;
+    return true;
+}
 
-        // if loaded find corresponding function
-        if(code == 1)
-            for(const auto& I : domain->get_external_module_pool()) {
-                if(I->locate_module(element_id)) I->new_object(new_element, command);
-                if(new_element != nullptr) break;
-            }
+int create_element_batch(const shared_ptr<DomainBase>& domain, const string& element_id, const vector<string>& argument) {
+    if(argument.empty()) return 0;
+
+    // external modules are loaded through the domain, they are created one by one
+    unique_ptr<Element> t_probe;
+    istringstream t_empty("");
+    if(!new_element_object(t_probe, element_id, t_empty)) {
+        for(const auto& I : argument) {
+            istringstream t_command(element_id + " " + I);
+            create_new_element(domain, t_command);
+        }
+        return 0;
     }
 
-    if(new_element == nullptr || !domain->insert(move(new_element))) suanpan_error("create_new_element() fails to create new element.\n");
+    vector<shared_ptr<Element>> t_element(argument.size());
+    parallel_for(argument.size(), [&](const size_t I) {
+        istringstream t_command(argument[I]);
+        unique_ptr<Element> t_object;
+        new_element_object(t_object, element_id, t_command);
+        t_element[I] = move(t_object);
+    });
+
+    const auto t_fail = std::count(t_element.cbegin(), t_element.cend(), nullptr);
+    if(t_fail != 0) suanpan_error("create_element_batch() fails to create %u %s elements.\n", unsigned(t_fail), element_id.c_str());
+
+    domain->insert(t_element);
 
     return 0;
 }
@@ -659,7 +698,25 @@ void new_f21(unique_ptr<Element>& return_obj, istringstream& command) {
     } else
         suanpan_extra_debug("new_f21() assumes linear geometry.\n");
 
-    return_obj = make_unique<F21>(tag, uvec(node_tag), section_id, int_pt, !!nonlinear);
+    unsigned max_iteration = 6;
+    if(!command.eof() && !get_input(command, max_iteration)) {
+        suanpan_debug("new_f21() needs a valid maximum number of local iterations.\n");
+        return;
+    }
+
+    auto tolerance = 1E-12;
+    if(!command.eof() && !get_input(command, tolerance)) {
+        suanpan_debug("new_f21() needs a valid local tolerance.\n");
+        return;
+    }
+
+    unsigned parallel = 0;
+    if(!command.eof() && !get_input(command, parallel)) {
+        suanpan_debug("new_f21() needs a valid parallel section switch (0,1).\n");
+        return;
+    }
+
+    return_obj = make_unique<F21>(tag, uvec(node_tag), section_id, int_pt, !!nonlinear, max_iteration, tolerance, !!parallel);
 }
 
 void new_f21h(unique_ptr<Element>& return_obj, istringstream& command) {
@@ -697,7 +754,25 @@ void new_f21h(unique_ptr<Element>& return_obj, istringstream& command) {
     } else
         suanpan_extra_debug("new_f21h() assumes linear geometry.\n");
 
-    return_obj = make_unique<F21H>(tag, uvec(node_tag), section_id, elastic_length, !!nonlinear);
+    unsigned max_iteration = 6;
+    if(!command.eof() && !get_input(command, max_iteration)) {
+        suanpan_debug("new_f21h() needs a valid maximum number of local iterations.\n");
+        return;
+    }
+
+    auto tolerance = 1E-12;
+    if(!command.eof() && !get_input(command, tolerance)) {
+        suanpan_debug("new_f21h() needs a valid local tolerance.\n");
+        return;
+    }
+
+    unsigned parallel = 0;
+    if(!command.eof() && !get_input(command, parallel)) {
+        suanpan_debug("new_f21h() needs a valid parallel section switch (0,1).\n");
+        return;
+    }
+
+    return_obj = make_unique<F21H>(tag, uvec(node_tag), section_id, elastic_length, !!nonlinear, max_iteration, tolerance, !!parallel);
 }
 
 void new_mass(unique_ptr<Element>& return_obj, istringstream& command) {
@@ -20,8 +20,16 @@
 
 #include <suanPan.h>
 
+using std::vector;
+
 int create_new_element(const shared_ptr<DomainBase>&, istringstream&);
 
+// built-in types only, does not touch any domain so it can be called concurrently
+bool new_element_object(unique_ptr<Element>&, const string&, istringstream&);
+
+// elements of one type from a list of arguments, built-in types are created concurrently
+int create_element_batch(const shared_ptr<DomainBase>&, const string&, const vector<string>&);
+
 void new_cp3(unique_ptr<Element>&, istringstream&);
 void new_cp4(unique_ptr<Element>&, istringstream&);
 void new_cp4r(unique_ptr<Element>&, istringstream&);
@@ -104,24 +104,21 @@ void ElementTemplate::initialize(const shared_ptr<DomainBase>& D) {
 }
 
 /**
- * @brief Now we handle the status update method. We get trial displacement via pointers and pass trial strain to the material model. Then get updated stiffness and stress back to form element stiffness and resistance.
+ * @brief Now we handle the status update method. We get trial displacement of the element and pass trial strain to the material model. Then get updated stiffness and stress back to form element stiffness and resistance.
+ *
+ * The base Element class provides `get_trial_displacement()` and similar methods, which collect the status of all DoFs of the element from the global storage in one go. They are the preferred way to obtain nodal status in `update_status()`.
  *
  * The pointers of related node objects are stored in a base member `node_ptr`, which is a `std::vector` of `weak_ptr`. (Why `weak_ptr`? To avoid potential wrong deallocation.) To access any methods in Node class, we use
  * ```cpp
  *     auto& my_ptr = node_ptr[i];
  *     my_ptr.lock()->call_any_valid_method();
  * ```
- * Please note that the `weak_ptr` has to be locked to generate a valid shared_ptr before calling any methods.
+ * Please note that the `weak_ptr` has to be locked to generate a valid shared_ptr before calling any methods. Locking is not free, so keep it out of `update_status()`.
  *
  * For a static analysis, **stiffness** and **resistance** have to be formulated. Apart from this, there is nothing you have to do. They will be send to global assembler by methods in base Element class, which can also be overridden to be customized.
  */
 int ElementTemplate::update_status() {
-    vec trial_disp(m_node * m_dof);
-    auto idx = 0;
-    for(auto i = 0; i < m_node; ++i) {
-        auto& tmp_disp = node_ptr[i].lock()->get_trial_displacement();
-        for(const auto& j : tmp_disp) trial_disp(idx++) = j;
-    }
+    const auto trial_disp = get_trial_displacement();
     m_material->update_trial_status(strain_mat * trial_disp);
 
     const mat t_factor = strain_mat.t() * area * thickness;
@@ -161,12 +161,13 @@ void CP3::initialize(const shared_ptr<DomainBase>& D) {
 }
 
 int CP3::update_status() {
+    const mat ele_disp = reshape(get_trial_displacement(), m_dof, m_node);
+
     vec t_strain(3, fill::zeros);
     for(auto J = 0; J < m_node; ++J) {
-        const auto& t_disp = node_ptr[J].lock()->get_trial_displacement();
-        t_strain(0) += t_disp(0) * pn_pxy(0, J);
-        t_strain(1) += t_disp(1) * pn_pxy(1, J);
-        t_strain(2) += t_disp(0) * pn_pxy(1, J) + t_disp(1) * pn_pxy(0, J);
+        t_strain(0) += ele_disp(0, J) * pn_pxy(0, J);
+        t_strain(1) += ele_disp(1, J) * pn_pxy(1, J);
+        t_strain(2) += ele_disp(0, J) * pn_pxy(1, J) + ele_disp(1, J) * pn_pxy(0, J);
     }
     m_material->update_trial_status(t_strain);
 
@@ -204,4 +205,8 @@ int CP3::clear_status() { return m_material->clear_status(); }
 
 int CP3::reset_status() { return m_material->reset_status(); }
 
+void CP3::save_status(vector<vec>& D) const { m_material->save_status(D); }
+
+void CP3::load_status(vector<vec>::const_iterator& D) { m_material->load_status(D); }
+
 void CP3::print() { suanpan_info("CP3 element.\n"); }
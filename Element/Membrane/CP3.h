@@ -55,6 +55,9 @@ public:
     int clear_status() override;
     int reset_status() override;
 
+    void save_status(vector<vec>&) const override;
+    void load_status(vector<vec>::const_iterator&) override;
+
     void print() override;
 };
 
@@ -81,8 +81,8 @@ void CP4::initialize(const shared_ptr<DomainBase>& D) {
 
     if(nlgeom)
         for(auto&& I : int_pt) {
-            I.BN.zeros(3, m_size);
-            I.BG.zeros(m_dof * m_dof, m_size);
+            I.BN.zeros();
+            I.BG.zeros();
             for(auto J = 0; J < m_node; ++J) {
                 I.BG(0, m_dof * J) = I.BG(2, m_dof * J + 1) = I.pn_pxy(0, J);
                 I.BG(1, m_dof * J) = I.BG(3, m_dof * J + 1) = I.pn_pxy(1, J);
@@ -109,12 +109,8 @@ void CP4::initialize(const shared_ptr<DomainBase>& D) {
 int CP4::update_status() {
     auto code = 0;
 
-    vec t_strain(3);
-    mat ele_disp(m_node, m_dof);
-    for(auto I = 0; I < m_node; ++I) {
-        auto& t_disp = node_ptr[I].lock()->get_trial_displacement();
-        for(auto J = 0; J < m_dof; ++J) ele_disp(I, J) = t_disp(J);
-    }
+    vec3 t_strain;
+    const mat::fixed<4, 2> ele_disp = reshape(get_trial_displacement(), m_dof, m_node).t();
 
     if(nlgeom) trial_geometry.zeros(m_size, m_size);
 
@@ -122,9 +118,9 @@ int CP4::update_status() {
     trial_resistance.zeros(m_size);
     for(auto& I : int_pt) {
         if(nlgeom) {
-            mat gradient = I.pn_pxy * ele_disp;
+            mat22 gradient = I.pn_pxy * ele_disp;
             gradient(0, 0) += 1., gradient(1, 1) += 1.;
-            mat t_mat = .5 * gradient * gradient.t();
+            const mat22 t_mat = .5 * gradient * gradient.t();
             t_strain(0) = t_mat(0, 0) - .5;
             t_strain(1) = t_mat(1, 1) - .5;
             t_strain(2) = t_mat(0, 1) + t_mat(1, 0);
@@ -141,10 +137,9 @@ int CP4::update_status() {
         } else {
             t_strain.zeros();
             for(auto J = 0; J < m_node; ++J) {
-                const auto& t_disp = node_ptr[J].lock()->get_trial_displacement();
-                t_strain(0) += t_disp(0) * I.pn_pxy(0, J);
-                t_strain(1) += t_disp(1) * I.pn_pxy(1, J);
-                t_strain(2) += t_disp(0) * I.pn_pxy(1, J) + t_disp(1) * I.pn_pxy(0, J);
+                t_strain(0) += ele_disp(J, 0) * I.pn_pxy(0, J);
+                t_strain(1) += ele_disp(J, 1) * I.pn_pxy(1, J);
+                t_strain(2) += ele_disp(J, 0) * I.pn_pxy(1, J) + ele_disp(J, 1) * I.pn_pxy(0, J);
             }
         }
 
@@ -156,7 +151,7 @@ int CP4::update_status() {
         auto& t_stress = I.m_material->get_stress();
 
         if(nlgeom) {
-            mat sigma(4, 4, fill::zeros);
+            mat44 sigma(fill::zeros);
             sigma(0, 0) = sigma(2, 2) = t_stress(0);
             sigma(1, 1) = sigma(3, 3) = t_stress(1);
             sigma(0, 1) = sigma(1, 0) = sigma(2, 3) = sigma(3, 2) = t_stress(2);
@@ -331,6 +326,14 @@ int CP4::reset_status() {
     return code;
 }
 
+void CP4::save_status(vector<vec>& D) const {
+    for(const auto& I : int_pt) I.m_material->save_status(D);
+}
+
+void CP4::load_status(vector<vec>::const_iterator& D) {
+    for(const auto& I : int_pt) I.m_material->load_status(D);
+}
+
 vector<vec> CP4::record(const OutputType& P) {
     vector<vec> output;
     output.reserve(int_pt.size());
@@ -33,11 +33,12 @@
 
 class CP4 final : public MaterialElement {
     struct IntegrationPoint {
-        vec coor;
+        vec2 coor;
         double weight, jacob_det;
         unique_ptr<Material> m_material;
-        mat pn_pxy;
-        mat BN, BG;
+        mat::fixed<2, 4> pn_pxy;
+        mat::fixed<3, 8> BN;
+        mat::fixed<4, 8> BG;
         IntegrationPoint(const vec&, const double, const double, unique_ptr<Material>&&, const mat&);
     };
 
@@ -67,6 +68,9 @@ public:
     int clear_status() override;
     int reset_status() override;
 
+    void save_status(vector<vec>&) const override;
+    void load_status(vector<vec>::const_iterator&) override;
+
     vector<vec> record(const OutputType&) override;
 
     void print() override;
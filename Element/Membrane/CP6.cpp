@@ -86,14 +86,15 @@ int CP6::update_status() {
     trial_stiffness.zeros(m_size, m_size);
     trial_resistance.zeros(m_size);
 
+    const mat ele_disp = reshape(get_trial_displacement(), m_dof, m_node);
+
     vec t_strain(3);
     for(const auto& I : int_pt) {
         t_strain.zeros();
         for(auto J = 0; J < m_node; ++J) {
-            const auto& t_disp = node_ptr[J].lock()->get_trial_displacement();
-            t_strain(0) += t_disp(0) * I.pn_pxy(0, J);
-            t_strain(1) += t_disp(1) * I.pn_pxy(1, J);
-            t_strain(2) += t_disp(0) * I.pn_pxy(1, J) + t_disp(1) * I.pn_pxy(0, J);
+            t_strain(0) += ele_disp(0, J) * I.pn_pxy(0, J);
+            t_strain(1) += ele_disp(1, J) * I.pn_pxy(1, J);
+            t_strain(2) += ele_disp(0, J) * I.pn_pxy(1, J) + ele_disp(1, J) * I.pn_pxy(0, J);
         }
         code += I.m_material->update_trial_status(t_strain);
 
@@ -343,4 +344,12 @@ int CP6::reset_status() {
     return code;
 }
 
+void CP6::save_status(vector<vec>& D) const {
+    for(const auto& I : int_pt) I.m_material->save_status(D);
+}
+
+void CP6::load_status(vector<vec>::const_iterator& D) {
+    for(const auto& I : int_pt) I.m_material->load_status(D);
+}
+
 void CP6::print() { suanpan_info("CP6 element.\n"); }
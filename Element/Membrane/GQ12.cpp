@@ -113,13 +113,9 @@ void GQ12::initialize(const shared_ptr<DomainBase>& D) {
 }
 
 int GQ12::update_status() {
-    auto code = 0, idx = 0;
+    auto code = 0;
 
-    vec trial_disp(m_size);
-    for(const auto& I : node_ptr) {
-        auto& tmp_disp = I.lock()->get_trial_displacement();
-        for(auto J = 0; J < m_dof; ++J) trial_disp(idx++) = tmp_disp(J);
-    }
+    const auto trial_disp = get_trial_displacement();
 
     trial_stiffness.zeros(m_size, m_size);
     trial_resistance.zeros(m_size);
@@ -151,6 +147,14 @@ int GQ12::reset_status() {
     return code;
 }
 
+void GQ12::save_status(vector<vec>& D) const {
+    for(const auto& I : int_pt) I.m_material->save_status(D);
+}
+
+void GQ12::load_status(vector<vec>::const_iterator& D) {
+    for(const auto& I : int_pt) I.m_material->load_status(D);
+}
+
 void GQ12::print() {
     suanpan_info("Material model response:\n");
     for(auto I = 0; I < int_pt.size(); ++I) {
@@ -112,13 +112,7 @@ void PS::initialize(const shared_ptr<DomainBase>& D) {
 }
 
 int PS::update_status() {
-    vec trial_disp(m_size);
-
-    auto idx = 0;
-    for(const auto& I : node_ptr) {
-        auto& tmp_disp = I.lock()->get_trial_displacement();
-        for(auto J = 0; J < m_dof; ++J) trial_disp(idx++) = tmp_disp(J);
-    }
+    const auto trial_disp = get_trial_displacement();
 
     trial_resistance = trial_stiffness * trial_disp;
 
@@ -142,3 +136,11 @@ int PS::reset_status() {
     for(const auto& I : int_pt) code += I.m_material->reset_status();
     return code;
 }
+
+void PS::save_status(vector<vec>& D) const {
+    for(const auto& I : int_pt) I.m_material->save_status(D);
+}
+
+void PS::load_status(vector<vec>::const_iterator& D) {
+    for(const auto& I : int_pt) I.m_material->load_status(D);
+}
@@ -206,11 +206,7 @@ void Proto01::initialize(const shared_ptr<DomainBase>& D) {
 }
 
 int Proto01::update_status() {
-    auto idx = 0;
-    for(const auto& t_ptr : node_ptr) {
-        auto& t_disp = t_ptr.lock()->get_trial_displacement();
-        for(auto pos = 0; pos < m_dof; ++pos) trial_disp(idx++) = t_disp(pos);
-    }
+    trial_disp = get_trial_displacement();
 
     const vec incre_disp = trial_disp - current_disp;
     const vec incre_lambda = -trial_qtitt * incre_disp - trial_qtifi; // eq. 65
@@ -281,17 +277,31 @@ int Proto01::reset_status() {
 
     trial_qtitt = current_qtitt;
 
-    auto idx = 0;
-    for(const auto& t_ptr : node_ptr) {
-        auto& t_disp = t_ptr.lock()->get_current_displacement();
-        for(auto pos = 0; pos < m_dof; ++pos) current_disp(idx++) = t_disp(pos);
-    }
+    current_disp = get_current_displacement();
 
     auto code = 0;
     for(const auto& I : int_pt) code += I.m_material->reset_status();
     return code;
 }
 
+void Proto01::save_status(vector<vec>& D) const {
+    D.emplace_back(current_lambda);
+    D.emplace_back(current_alpha);
+    D.emplace_back(current_beta);
+    D.emplace_back(vectorise(current_qtitt));
+    D.emplace_back(vectorise(current_qtifi));
+    for(const auto& I : int_pt) I.m_material->save_status(D);
+}
+
+void Proto01::load_status(vector<vec>::const_iterator& D) {
+    current_lambda = *D++;
+    current_alpha = *D++;
+    current_beta = *D++;
+    current_qtitt = reshape(*D++, size(current_qtitt));
+    current_qtifi = reshape(*D++, size(current_qtifi));
+    for(const auto& I : int_pt) I.m_material->load_status(D);
+}
+
 vector<vec> Proto01::record(const OutputType& T) {
     vector<vec> data;
     switch(T) {
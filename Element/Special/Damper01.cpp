@@ -51,11 +51,11 @@ int Damper01::update_status() {
     auto& coor_i = node_i->get_coordinate();
     auto& coor_j = node_j->get_coordinate();
 
-    auto& disp_i = node_i->get_trial_displacement();
-    auto& disp_j = node_j->get_trial_displacement();
+    const auto t_disp = get_trial_displacement();
+    const auto t_vel = get_trial_velocity();
 
-    auto& velocity_i = node_i->get_trial_velocity();
-    auto& velocity_j = node_j->get_trial_velocity();
+    const vec disp_i = t_disp.head(d_dof), disp_j = t_disp.tail(d_dof);
+    const vec velocity_i = t_vel.head(d_dof), velocity_j = t_vel.tail(d_dof);
 
     vec pos_diff(2);
     pos_diff(0) = coor_j(0) - coor_i(0) + disp_j(0) - disp_i(0);
@@ -33,9 +33,7 @@ void SingleSection::initialize(const shared_ptr<DomainBase>& D) {
 }
 
 int SingleSection::update_status() {
-    const auto& s_node = node_ptr[0].lock();
-
-    s_section->update_trial_status(s_node->get_trial_displacement());
+    s_section->update_trial_status(get_trial_displacement());
 
     trial_stiffness = s_section->get_stiffness();
 
@@ -49,3 +47,7 @@ int SingleSection::commit_status() { return s_section->commit_status(); }
 int SingleSection::clear_status() { return s_section->clear_status(); }
 
 int SingleSection::reset_status() { return s_section->reset_status(); }
+
+void SingleSection::save_status(vector<vec>& D) const { s_section->save_status(D); }
+
+void SingleSection::load_status(vector<vec>::const_iterator& D) { s_section->load_status(D); }
@@ -37,17 +37,14 @@ void Spring01::initialize(const shared_ptr<DomainBase>& D) {
 }
 
 int Spring01::update_status() {
-    const auto& node_i = node_ptr.at(0).lock();
-    const auto& node_j = node_ptr.at(1).lock();
-
-    auto& disp_i = node_i->get_trial_displacement();
-    auto& disp_j = node_j->get_trial_displacement();
+    const auto t_disp = get_trial_displacement();
+    const vec disp_i = t_disp.head(s_dof), disp_j = t_disp.tail(s_dof);
 
     vec new_position(2);
     new_position(0) = disp_j(0) - disp_i(0);
     new_position(1) = disp_j(1) - disp_i(1);
 
-    new_position += node_j->get_coordinate() - node_i->get_coordinate();
+    new_position += node_ptr.at(1).lock()->get_coordinate() - node_ptr.at(0).lock()->get_coordinate();
 
     const auto new_length = norm(new_position);
 
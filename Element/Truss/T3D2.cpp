@@ -48,13 +48,10 @@ void T3D2::initialize(const shared_ptr<DomainBase>& D) {
 }
 
 int T3D2::update_status() {
-    const auto& node_i = node_ptr.at(0).lock();
-    const auto& node_j = node_ptr.at(1).lock();
-
     // in a truss-beam system a node may have either 2 or 3 dofs depends on the type of elements connected
-    // resize the displacement vectors to make sure they are compatiable with the truss formulation
-    auto& disp_i = node_i->get_trial_displacement();
-    auto& disp_j = node_j->get_trial_displacement();
+    // the dof encoding only picks the translational ones which are compatiable with the truss formulation
+    const auto t_disp = get_trial_displacement();
+    const vec disp_i = t_disp.head(t_dof), disp_j = t_disp.tail(t_dof);
     vec disp_diff(3);
     disp_diff(0) = disp_j(0) - disp_i(0);
     disp_diff(1) = disp_j(1) - disp_i(1);
@@ -69,4 +66,8 @@ int T3D2::clear_status() { return t_material->clear_status(); }
 
 int T3D2::reset_status() { return t_material->reset_status(); }
 
+void T3D2::save_status(vector<vec>& D) const { t_material->save_status(D); }
+
+void T3D2::load_status(vector<vec>::const_iterator& D) { t_material->load_status(D); }
+
 void T3D2::print() {}
@@ -43,10 +43,21 @@ namespace mass {
     template <typename T> void lumped_simple::apply(Mat<T>& mass) { mass = diagmat(sum(mass)); }
 
     struct lumped_scale {
-        template <typename T> static void apply(Mat<T>&);
+        template <typename T> static void apply(Mat<T>&, const unsigned& = 1);
     };
 
-    template <typename T> void lumped_scale::apply(Mat<T>& mass) {}
+    /**
+     * @brief HRZ lumping, the diagonal is scaled so that the total mass of each DoF direction is preserved.
+     */
+    template <typename T> void lumped_scale::apply(Mat<T>& mass, const unsigned& num_dof) {
+        Col<T> t_diag = mass.diag();
+        for(unsigned I = 0; I < num_dof && I < mass.n_rows; ++I) {
+            const uvec t_idx = regspace<uvec>(I, num_dof, mass.n_rows - 1);
+            const auto t_sum = accu(t_diag(t_idx));
+            if(t_sum != T(0)) t_diag(t_idx) *= accu(mass(t_idx, t_idx)) / t_sum;
+        }
+        mass = diagmat(t_diag);
+    }
 }
 namespace damping {
     struct rayleigh {
@@ -48,3 +48,18 @@ int Acceleration::process(const shared_ptr<DomainBase>& D) {
 
     return 0;
 }
+
+vec Acceleration::get_reference_load(const shared_ptr<DomainBase>& D) {
+    const auto& t_factory = D->get_factory();
+
+    if(t_factory->get_mass() == nullptr) return {};
+
+    vec ref_acc(t_factory->get_size(), fill::zeros);
+    for(const auto& I : D->get_node_pool()) {
+        auto& t_dof = I->get_reordered_dof();
+        for(const auto& J : dofs)
+            if(J <= t_dof.n_elem) ref_acc(t_dof(J - 1)) = 1.;
+    }
+
+    return -pattern * (get_mass(t_factory) * ref_acc);
+}
@@ -47,6 +47,8 @@ public:
         const unsigned& = 0);                  // amplitude tag
 
     int process(const shared_ptr<DomainBase>&) override;
+
+    vec get_reference_load(const shared_ptr<DomainBase>&) override;
 };
 
 #endif // ACCELERATION_H
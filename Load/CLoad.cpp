@@ -53,3 +53,18 @@ int CLoad::process(const shared_ptr<DomainBase>& D) {
 
     return 0;
 }
+
+vec CLoad::get_reference_load(const shared_ptr<DomainBase>& D) {
+    vec ref_load(D->get_factory()->get_size(), fill::zeros);
+
+    for(const auto& I : nodes) {
+        auto& t_node = D->get_node(static_cast<unsigned>(I));
+        if(t_node != nullptr && t_node->is_active()) {
+            auto& t_dof = t_node->get_reordered_dof();
+            for(const auto& J : dofs)
+                if(J <= t_dof.n_elem) ref_load(t_dof(J - 1)) += pattern;
+        }
+    }
+
+    return ref_load;
+}
@@ -51,6 +51,8 @@ public:
     );
 
     int process(const shared_ptr<DomainBase>&) override;
+
+    vec get_reference_load(const shared_ptr<DomainBase>&) override;
 };
 
 #endif
@@ -56,6 +56,14 @@ int Load::initialize(const shared_ptr<DomainBase>& D) {
 
 int Load::process(const shared_ptr<DomainBase>&) { return -1; }
 
+/**
+ * \brief Method to get the global load vector of unit amplitude.
+ * \return empty if the load cannot be expressed as a fixed pattern
+ */
+vec Load::get_reference_load(const shared_ptr<DomainBase>&) { return {}; }
+
+double Load::get_amplitude(const double& T) const { return magnitude == nullptr ? 0. : magnitude->get_amplitude(T); }
+
 void Load::set_start_step(const unsigned& T) { start_step = T; }
 
 const unsigned& Load::get_start_step() const { return start_step; }
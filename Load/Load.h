@@ -20,6 +20,11 @@
  *
  * The Load class is in charge of returning load level according to given time increment.
  *
+ * A load is the product of a spatial pattern and a time dependent amplitude.
+ * Loads that can provide the pattern as a global vector override
+ * `get_reference_load()`, so that the load can be evaluated at any time by
+ * scaling the pattern with `get_amplitude()` without processing it again.
+ *
  * @author T
  * @date 01/10/2017
  * @version 0.2.0
@@ -58,6 +63,10 @@ public:
 
     virtual int process(const shared_ptr<DomainBase>&) = 0;
 
+    virtual vec get_reference_load(const shared_ptr<DomainBase>&);
+
+    double get_amplitude(const double&) const;
+
     void set_start_step(const unsigned&);
     const unsigned& get_start_step() const;
 
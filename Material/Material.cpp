@@ -16,6 +16,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Material.h"
+#include <Material/MaterialBatch.h>
 
 Material::Material(const unsigned T, const unsigned CT, const MaterialType MT, const double D)
     : Tag(T, CT)
@@ -62,6 +63,8 @@ const mat& Material::get_initial_stiffness() const { return initial_stiffness; }
 
 unique_ptr<Material> Material::get_copy() { throw invalid_argument("hidden method get_copy() called.\n"); }
 
+unique_ptr<MaterialBatch> Material::get_batch(const unsigned N) { return make_unique<PointBatch>(N, *this); }
+
 int Material::update_incre_status(const double i_strain) {
     const vec i_vec_strain{ i_strain };
     return update_incre_status(i_vec_strain);
@@ -130,6 +133,24 @@ int Material::reset_status() {
 
 vector<vec> Material::record(const OutputType&) { return {}; }
 
+void Material::save_status(vector<vec>& D) const {
+    D.emplace_back(current_strain);
+    D.emplace_back(current_strain_rate);
+    D.emplace_back(current_stress);
+    D.emplace_back(current_stress_rate);
+    D.emplace_back(current_history);
+    D.emplace_back(vectorise(current_stiffness));
+}
+
+void Material::load_status(vector<vec>::const_iterator& D) {
+    current_strain = *D++;
+    current_strain_rate = *D++;
+    current_stress = *D++;
+    current_stress_rate = *D++;
+    current_history = *D++;
+    current_stiffness = reshape(*D++, size(current_stiffness));
+}
+
 unique_ptr<Material> suanpan::make_copy(const shared_ptr<Material>& P) { return P->get_copy(); }
 
 unique_ptr<Material> suanpan::make_copy(const unique_ptr<Material>& P) { return P->get_copy(); }
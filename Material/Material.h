@@ -35,6 +35,7 @@ enum class MaterialType : unsigned { D0 = 0, D1 = 1, D2 = 3, D3 = 6 };
 enum class PlaneType { S, E, N };
 
 class DomainBase;
+class MaterialBatch;
 enum class OutputType;
 
 using std::vector;
@@ -87,6 +88,7 @@ public:
     virtual const mat& get_initial_stiffness() const;
 
     virtual unique_ptr<Material> get_copy() = 0;
+    virtual unique_ptr<MaterialBatch> get_batch(const unsigned);
 
     int update_incre_status(const double);
     int update_incre_status(const double, const double);
@@ -103,6 +105,9 @@ public:
     virtual int reset_status() = 0;
 
     virtual vector<vec> record(const OutputType&);
+
+    virtual void save_status(vector<vec>&) const;
+    virtual void load_status(vector<vec>::const_iterator&);
 };
 
 namespace suanpan {
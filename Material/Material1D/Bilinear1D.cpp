@@ -16,7 +16,22 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Bilinear1D.h"
+#include <Material/MaterialBatch.h>
 #include <Toolbox/utility.h>
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
+
+class Bilinear1D::Batch final : public MaterialBatch {
+    const Bilinear1D material;
+
+public:
+    Batch(const unsigned, const Bilinear1D&);
+
+    unique_ptr<MaterialBatch> get_copy() override;
+
+    int update_trial_status(const mat&) override;
+};
 
 Bilinear1D::Bilinear1D(const unsigned& T, const double& E, const double& Y, const double& H, const double& B, const double& R)
     : Material1D(T, MT_BILINEAR1D, R)
@@ -36,31 +51,12 @@ void Bilinear1D::initialize(const shared_ptr<DomainBase>&) {
 
 unique_ptr<Material> Bilinear1D::get_copy() { return make_unique<Bilinear1D>(*this); }
 
+unique_ptr<MaterialBatch> Bilinear1D::get_batch(const unsigned N) { return make_unique<Batch>(N, *this); }
+
 int Bilinear1D::update_trial_status(const vec& t_strain) {
     trial_strain = t_strain;
-    incre_strain = trial_strain - current_strain;
 
-    if(incre_strain(0) == 0.) return 0;
-
-    trial_history = current_history;
-    auto& trial_back_stress = trial_history(0);
-    auto& trial_plastic_strain = trial_history(1);
-
-    trial_stiffness = initial_stiffness;
-
-    trial_stress = current_stress + elastic_modulus * incre_strain;
-
-    const auto shifted_stress = trial_stress(0) - trial_back_stress;
-
-    const auto yield_func = abs(shifted_stress) - yield_stress - (1. - beta) * plastic_modulus * trial_plastic_strain;
-
-    if(yield_func > tolerance) {
-        const auto incre_plastic_strain = yield_func / (elastic_modulus + plastic_modulus);
-        trial_stress -= suanpan::sign(shifted_stress) * elastic_modulus * incre_plastic_strain;
-        trial_stiffness *= hardening_ratio;
-        trial_back_stress += suanpan::sign(shifted_stress) * beta * plastic_modulus * incre_plastic_strain;
-        trial_plastic_strain += incre_plastic_strain;
-    }
+    compute_trial_status(trial_strain(0), current_strain(0), current_stress(0), current_history.memptr(), trial_stress(0), trial_stiffness(0), trial_history.memptr());
 
     return 0;
 }
@@ -88,3 +84,101 @@ int Bilinear1D::reset_status() {
     trial_stiffness = current_stiffness;
     return 0;
 }
+
+// shared by the material object and the batch, the trial status is left untouched if the strain does not change
+void Bilinear1D::compute_trial_status(const double t_strain, const double c_strain, const double c_stress, const double* c_history, double& t_stress, double& t_stiffness, double* t_history) const {
+    const auto incre_strain = t_strain - c_strain;
+
+    if(incre_strain == 0.) return;
+
+    auto& trial_back_stress = t_history[0] = c_history[0];
+    auto& trial_plastic_strain = t_history[1] = c_history[1];
+
+    t_stiffness = elastic_modulus;
+
+    t_stress = c_stress + elastic_modulus * incre_strain;
+
+    const auto shifted_stress = t_stress - trial_back_stress;
+
+    const auto yield_func = abs(shifted_stress) - yield_stress - (1. - beta) * plastic_modulus * trial_plastic_strain;
+
+    if(yield_func > tolerance) {
+        const auto incre_plastic_strain = yield_func / (elastic_modulus + plastic_modulus);
+        t_stress -= suanpan::sign(shifted_stress) * elastic_modulus * incre_plastic_strain;
+        t_stiffness *= hardening_ratio;
+        trial_back_stress += suanpan::sign(shifted_stress) * beta * plastic_modulus * incre_plastic_strain;
+        trial_plastic_strain += incre_plastic_strain;
+    }
+}
+
+Bilinear1D::Batch::Batch(const unsigned N, const Bilinear1D& P)
+    : MaterialBatch(N, P, P.current_history)
+    , material(P) {}
+
+unique_ptr<MaterialBatch> Bilinear1D::Batch::get_copy() { return make_unique<Batch>(*this); }
+
+int Bilinear1D::Batch::update_trial_status(const mat& t_strain) {
+    trial_strain = t_strain;
+
+    const auto t_epsilon = trial_strain.memptr();
+    const auto c_epsilon = current_strain.memptr();
+    const auto c_sigma = current_stress.memptr();
+    const auto t_sigma = trial_stress.memptr();
+    const auto t_stiffness = trial_stiffness.memptr();
+
+    unsigned I = 0;
+#ifdef __AVX__
+    // four points per pass, the branches of the scalar kernel are replaced by masks and the order of operations is kept
+    const auto& M = material;
+    const auto one = _mm256_set1_pd(1.), zero = _mm256_setzero_pd(), sign_bit = _mm256_set1_pd(-0.);
+    const auto elastic_modulus = _mm256_set1_pd(M.elastic_modulus);
+    const auto yield_stress = _mm256_set1_pd(M.yield_stress);
+    const auto isotropic_modulus = _mm256_set1_pd((1. - M.beta) * M.plastic_modulus);
+    const auto total_modulus = _mm256_set1_pd(M.elastic_modulus + M.plastic_modulus);
+    const auto plastic_stiffness = _mm256_set1_pd(M.elastic_modulus * M.hardening_ratio);
+    const auto beta = _mm256_set1_pd(M.beta);
+    const auto plastic_modulus = _mm256_set1_pd(M.plastic_modulus);
+    const auto tolerance = _mm256_set1_pd(M.tolerance);
+    const auto c_h = current_history.memptr();
+    const auto t_h = trial_history.memptr();
+    for(; I + 4 <= n_point; I += 4) {
+        const auto incre_strain = _mm256_sub_pd(_mm256_loadu_pd(t_epsilon + I), _mm256_loadu_pd(c_epsilon + I));
+        const auto active = _mm256_cmp_pd(incre_strain, zero, _CMP_NEQ_OQ);
+        if(_mm256_movemask_pd(active) == 0) continue;
+
+        const auto c_back_stress = _mm256_set_pd(c_h[2 * I + 6], c_h[2 * I + 4], c_h[2 * I + 2], c_h[2 * I]);
+        const auto c_plastic_strain = _mm256_set_pd(c_h[2 * I + 7], c_h[2 * I + 5], c_h[2 * I + 3], c_h[2 * I + 1]);
+
+        auto n_stress = _mm256_add_pd(_mm256_loadu_pd(c_sigma + I), _mm256_mul_pd(elastic_modulus, incre_strain));
+        const auto shifted_stress = _mm256_sub_pd(n_stress, c_back_stress);
+        const auto yield_func = _mm256_sub_pd(_mm256_sub_pd(_mm256_andnot_pd(sign_bit, shifted_stress), yield_stress), _mm256_mul_pd(isotropic_modulus, c_plastic_strain));
+        const auto yielding = _mm256_cmp_pd(yield_func, tolerance, _CMP_GT_OQ);
+
+        const auto incre_plastic_strain = _mm256_div_pd(yield_func, total_modulus);
+        const auto sign = _mm256_sub_pd(_mm256_and_pd(_mm256_cmp_pd(shifted_stress, zero, _CMP_GT_OQ), one), _mm256_and_pd(_mm256_cmp_pd(shifted_stress, zero, _CMP_LT_OQ), one));
+
+        n_stress = _mm256_blendv_pd(n_stress, _mm256_sub_pd(n_stress, _mm256_mul_pd(_mm256_mul_pd(sign, elastic_modulus), incre_plastic_strain)), yielding);
+        auto n_stiffness = _mm256_blendv_pd(elastic_modulus, plastic_stiffness, yielding);
+        auto n_back_stress = _mm256_blendv_pd(c_back_stress, _mm256_add_pd(c_back_stress, _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(sign, beta), plastic_modulus), incre_plastic_strain)), yielding);
+        auto n_plastic_strain = _mm256_blendv_pd(c_plastic_strain, _mm256_add_pd(c_plastic_strain, incre_plastic_strain), yielding);
+
+        // points with zero strain increment keep their trial status
+        n_stiffness = _mm256_blendv_pd(_mm256_loadu_pd(t_stiffness + I), n_stiffness, active);
+        n_back_stress = _mm256_blendv_pd(_mm256_set_pd(t_h[2 * I + 6], t_h[2 * I + 4], t_h[2 * I + 2], t_h[2 * I]), n_back_stress, active);
+        n_plastic_strain = _mm256_blendv_pd(_mm256_set_pd(t_h[2 * I + 7], t_h[2 * I + 5], t_h[2 * I + 3], t_h[2 * I + 1]), n_plastic_strain, active);
+        _mm256_storeu_pd(t_sigma + I, _mm256_blendv_pd(_mm256_loadu_pd(t_sigma + I), n_stress, active));
+        _mm256_storeu_pd(t_stiffness + I, n_stiffness);
+
+        double buffer[8];
+        _mm256_storeu_pd(buffer, n_back_stress);
+        _mm256_storeu_pd(buffer + 4, n_plastic_strain);
+        for(unsigned J = 0; J < 4; ++J) {
+            t_h[2 * (I + J)] = buffer[J];
+            t_h[2 * (I + J) + 1] = buffer[J + 4];
+        }
+    }
+#endif
+    for(; I < n_point; ++I) material.compute_trial_status(t_epsilon[I], c_epsilon[I], c_sigma[I], current_history.colptr(I), t_sigma[I], t_stiffness[I], trial_history.colptr(I));
+
+    return 0;
+}
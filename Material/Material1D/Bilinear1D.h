@@ -31,6 +31,8 @@
 #include <Material/Material1D/Material1D.h>
 
 class Bilinear1D final : public Material1D {
+    class Batch;
+
     const double elastic_modulus; /**< elastic modulus */
     const double yield_stress;    /**< initial yield stress */
     const double hardening_ratio; /**< hardening ratio */
@@ -39,6 +41,8 @@ class Bilinear1D final : public Material1D {
 
     const double tolerance;
 
+    void compute_trial_status(const double, const double, const double, const double*, double&, double&, double*) const;
+
 public:
     explicit Bilinear1D(const unsigned& = 0, /**< tag */
         const double& = 2E5,                 /**< elastic modulus */
@@ -50,6 +54,7 @@ public:
     void initialize(const shared_ptr<DomainBase>&) override;
 
     unique_ptr<Material> get_copy() override;
+    unique_ptr<MaterialBatch> get_batch(const unsigned) override;
 
     int update_trial_status(const vec&) override;
 
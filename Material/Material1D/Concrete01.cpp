@@ -16,8 +16,26 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Concrete01.h"
+#include <Material/MaterialBatch.h>
 #include <Toolbox/utility.h>
 
+class Concrete01::Batch final : public MaterialBatch {
+    const Concrete01 material;
+
+    mat backbone_flag; // not committed, as in the material object
+public:
+    Batch(const unsigned, const Concrete01&);
+
+    unique_ptr<MaterialBatch> get_copy() override;
+
+    int update_trial_status(const mat&) override;
+
+    int clear_status() override;
+
+    void save_status(vector<vec>&) const override;
+    void load_status(vector<vec>::const_iterator&) override;
+};
+
 const double Concrete01::crack_strain = 8E-5;
 
 Concrete01::Concrete01(const unsigned& T, const double& EP, const double& SP, const BackboneType& TP, const bool& CO, const double& R)
@@ -51,7 +69,7 @@ void Concrete01::initialize(const shared_ptr<DomainBase>&) {
     current_history.zeros(6);
     trial_history.zeros(6);
 
-    compute_compression_backbone();
+    compute_compression_backbone(trial_strain(0), trial_stress(0), trial_stiffness(0));
 
     initial_stiffness = trial_stiffness;
     current_stiffness = initial_stiffness;
@@ -62,164 +80,224 @@ void Concrete01::initialize(const shared_ptr<DomainBase>&) {
 
 unique_ptr<Material> Concrete01::get_copy() { return make_unique<Concrete01>(*this); }
 
+unique_ptr<MaterialBatch> Concrete01::get_batch(const unsigned N) { return make_unique<Batch>(N, *this); }
+
 int Concrete01::update_trial_status(const vec& t_strain) {
     trial_strain = t_strain;
-    incre_strain = trial_strain - current_strain;
 
-    if(incre_strain(0) == 0.) return 0;
+    compute_trial_status(trial_strain(0), current_strain(0), current_stress(0), current_stiffness(0), current_history.memptr(), trial_stress(0), trial_stiffness(0), trial_history.memptr(), backbone_flag.memptr());
 
+    return 0;
+}
+
+int Concrete01::clear_status() {
+    current_strain.zeros();
+    current_stress.zeros();
+    current_history.zeros();
+    current_stiffness = initial_stiffness;
+    return reset_status();
+}
+
+int Concrete01::commit_status() {
+    current_strain = trial_strain;
+    current_stress = trial_stress;
+    current_history = trial_history;
+    current_stiffness = trial_stiffness;
+    return 0;
+}
+
+int Concrete01::reset_status() {
+    trial_strain = current_strain;
+    trial_stress = current_stress;
     trial_history = current_history;
-    auto& max_strain = trial_history(0);      // maximum compression strain logged
-    auto& residual_strain = trial_history(1); // residual strain in unloading path
-    auto& trial_cr_strain = trial_history(2); // unloading point strain compression side
-    auto& trial_cr_stress = trial_history(3); // unloading point stress compression side
-    auto& trial_tr_strain = trial_history(4); // unloading point strain tension side
-    auto& trial_tr_stress = trial_history(5); // unloading point stress tension side
-
-    if(trial_strain(0) < max_strain) {
-        max_strain = trial_strain(0);
+    trial_stiffness = current_stiffness;
+    return 0;
+}
+
+void Concrete01::save_status(vector<vec>& D) const {
+    Material::save_status(D);
+    D.emplace_back(backbone_flag);
+}
+
+void Concrete01::load_status(vector<vec>::const_iterator& D) {
+    Material::load_status(D);
+    backbone_flag = *D++;
+}
+
+// shared by the material object and the batch, the trial status is left untouched if the strain does not change
+void Concrete01::compute_trial_status(const double t_strain, const double c_strain, const double c_stress, const double c_stiffness, const double* c_history, double& t_stress, double& t_stiffness, double* t_history, double* flag) const {
+    const auto incre_strain = t_strain - c_strain;
+
+    if(incre_strain == 0.) return;
+
+    std::copy(c_history, c_history + 6, t_history);
+    auto& max_strain = t_history[0];      // maximum compression strain logged
+    auto& residual_strain = t_history[1]; // residual strain in unloading path
+    auto& trial_cr_strain = t_history[2]; // unloading point strain compression side
+    auto& trial_cr_stress = t_history[3]; // unloading point stress compression side
+    auto& trial_tr_strain = t_history[4]; // unloading point strain tension side
+    auto& trial_tr_stress = t_history[5]; // unloading point stress tension side
+
+    auto& tension_origin = flag[0];
+    auto& on_compression_backbone = flag[1];
+    auto& on_tension_backbone = flag[2];
+    auto& first_tension = flag[3];
+
+    if(t_strain < max_strain) {
+        max_strain = t_strain;
         if(!center_oriented) residual_strain = .145 * max_strain * max_strain / peak_strain + .13 * max_strain;
     }
 
-    const auto strain_a = trial_strain(0) - residual_strain;
+    const auto strain_a = t_strain - residual_strain;
     const auto side = suanpan::sign(strain_a);
-    const auto load_direction = suanpan::sign(incre_strain(0));
+    const auto load_direction = suanpan::sign(incre_strain);
 
     if(side == -1)
         // the trial position is in compression zone
         // if current position is on backbone
-        if(on_compression_backbone) {
+        if(on_compression_backbone != 0.) {
             // yes on backbone
             if(load_direction == -1.)
                 // loading
-                compute_compression_backbone();
+                compute_compression_backbone(t_strain, t_stress, t_stiffness);
             else if(load_direction == 1.) {
                 // unloading
-                on_compression_backbone = false;
-                trial_cr_strain = current_strain(0);
-                trial_cr_stress = current_stress(0);
-                trial_stiffness = trial_cr_stress / (trial_cr_strain - residual_strain);
-                trial_stress = trial_stiffness * strain_a;
+                on_compression_backbone = 0.;
+                trial_cr_strain = c_strain;
+                trial_cr_stress = c_stress;
+                t_stiffness = trial_cr_stress / (trial_cr_strain - residual_strain);
+                t_stress = t_stiffness * strain_a;
             }
-        } else if(trial_strain(0) >= trial_cr_strain) {
+        } else if(t_strain >= trial_cr_strain) {
             // still inside backbone
-            trial_stiffness = trial_cr_stress / (trial_cr_strain - residual_strain);
-            trial_stress = trial_stiffness * strain_a;
+            t_stiffness = trial_cr_stress / (trial_cr_strain - residual_strain);
+            t_stress = t_stiffness * strain_a;
         } else {
             // reload to backbone
-            on_compression_backbone = true;
-            compute_compression_backbone();
+            on_compression_backbone = 1.;
+            compute_compression_backbone(t_strain, t_stress, t_stiffness);
         }
     else {
         // enter tension for the fist time
-        if(current_stress(0) <= 0. && !first_tension) {
-            first_tension = true;
-            tension_origin = current_strain(0) - current_stress(0) / current_stiffness(0);
+        if(c_stress <= 0. && first_tension == 0.) {
+            first_tension = 1.;
+            tension_origin = c_strain - c_stress / c_stiffness;
         }
         // the trial position is in tension zone
-        if(on_tension_backbone) {
+        if(on_tension_backbone != 0.) {
             // yes on backbone
             if(load_direction == 1.) {
                 // loading for first time
-                compute_tension_backbone();
+                compute_tension_backbone(t_strain, tension_origin, t_stress, t_stiffness);
             } else if(load_direction == -1.) {
                 // unloading
-                on_tension_backbone = false;
-                trial_tr_strain = current_strain(0);
-                trial_tr_stress = current_stress(0);
-                trial_stiffness = trial_tr_stress / (trial_tr_strain - residual_strain);
-                trial_stress = trial_stiffness * strain_a;
+                on_tension_backbone = 0.;
+                trial_tr_strain = c_strain;
+                trial_tr_stress = c_stress;
+                t_stiffness = trial_tr_stress / (trial_tr_strain - residual_strain);
+                t_stress = t_stiffness * strain_a;
             }
-        } else if(trial_strain(0) <= trial_tr_strain) {
+        } else if(t_strain <= trial_tr_strain) {
             // no not on backbone but still inside of backbone
-            trial_stiffness = trial_tr_stress / (trial_tr_strain - residual_strain);
-            trial_stress = trial_stiffness * strain_a;
+            t_stiffness = trial_tr_stress / (trial_tr_strain - residual_strain);
+            t_stress = t_stiffness * strain_a;
         } else {
             // reloading from unloading path
-            on_tension_backbone = true;
-            compute_tension_backbone();
+            on_tension_backbone = 1.;
+            compute_tension_backbone(t_strain, tension_origin, t_stress, t_stiffness);
         }
     }
-
-    return 0;
 }
 
-int Concrete01::clear_status() {
-    current_strain.zeros();
-    current_stress.zeros();
-    current_history.zeros();
-    current_stiffness = initial_stiffness;
-    return reset_status();
-}
-
-int Concrete01::commit_status() {
-    current_strain = trial_strain;
-    current_stress = trial_stress;
-    current_history = trial_history;
-    current_stiffness = trial_stiffness;
-    return 0;
-}
-
-int Concrete01::reset_status() {
-    trial_strain = current_strain;
-    trial_stress = current_stress;
-    trial_history = current_history;
-    trial_stiffness = current_stiffness;
-    return 0;
-}
-
-void Concrete01::compute_compression_backbone() {
-    const auto normal_strain = trial_strain(0) / peak_strain;
+void Concrete01::compute_compression_backbone(const double t_strain, double& t_stress, double& t_stiffness) const {
+    const auto normal_strain = t_strain / peak_strain;
     switch(backbone_type) {
     case BackboneType::POPOVICS: {
         const auto tmp_a = pow(normal_strain, N) - 1.;
         const auto tmp_b = tmp_a + N;
-        trial_stress = peak_stress * normal_strain * N / tmp_b;
-        trial_stiffness = peak_stress * N * tmp_a * (1. - N) / peak_strain / tmp_b / tmp_b;
+        t_stress = peak_stress * normal_strain * N / tmp_b;
+        t_stiffness = peak_stress * N * tmp_a * (1. - N) / peak_strain / tmp_b / tmp_b;
         break;
     }
     case BackboneType::THORENFELDT: {
         const auto tmp_a = pow(normal_strain, N * M);
         const auto tmp_b = N - 1. + tmp_a;
-        trial_stress = peak_stress * normal_strain * N / tmp_b;
-        trial_stiffness = N * ((N - 1.) * normal_strain - (M * N - 1.) * tmp_a) / peak_strain / tmp_b / tmp_b;
+        t_stress = peak_stress * normal_strain * N / tmp_b;
+        t_stiffness = N * ((N - 1.) * normal_strain - (M * N - 1.) * tmp_a) / peak_strain / tmp_b / tmp_b;
         break;
     }
     case BackboneType::TSAI: {
         const auto tmp_a = pow(normal_strain, N) - 1.;
         const auto tmp_b = N - 1.;
-        trial_stress = peak_stress * normal_strain * M / (1. + (M - N / tmp_b) * normal_strain + (tmp_a + 1.) / tmp_b);
-        trial_stiffness = -peak_stress * M * tmp_a * tmp_b * tmp_b / peak_strain / pow(tmp_a + N + normal_strain * (M * N - M - N), 2.);
+        t_stress = peak_stress * normal_strain * M / (1. + (M - N / tmp_b) * normal_strain + (tmp_a + 1.) / tmp_b);
+        t_stiffness = -peak_stress * M * tmp_a * tmp_b * tmp_b / peak_strain / pow(tmp_a + N + normal_strain * (M * N - M - N), 2.);
         break;
     }
     case BackboneType::KPSU:
     case BackboneType::KPSC: {
         const auto tmp_a = .5 / ((.29 * peak_stress - 3.) / (145. * peak_stress + 1000.) + peak_strain);
         const auto ultimate_strain = -.8 / tmp_a + peak_strain;
-        if(trial_strain(0) < ultimate_strain) {
-            trial_stress = 0.;
-            trial_stiffness = 0.;
-        } else if(trial_strain(0) < peak_strain) {
-            trial_stress = peak_stress + peak_stress * tmp_a * (trial_strain(0) - peak_strain);
-            trial_stiffness = peak_stress * tmp_a;
+        if(t_strain < ultimate_strain) {
+            t_stress = 0.;
+            t_stiffness = 0.;
+        } else if(t_strain < peak_strain) {
+            t_stress = peak_stress + peak_stress * tmp_a * (t_strain - peak_strain);
+            t_stiffness = peak_stress * tmp_a;
         } else {
-            trial_stress = peak_stress * normal_strain * (2. - normal_strain);
-            trial_stiffness = 2. * peak_stress / peak_strain * (1. - normal_strain);
+            t_stress = peak_stress * normal_strain * (2. - normal_strain);
+            t_stiffness = 2. * peak_stress / peak_strain * (1. - normal_strain);
         }
         break;
     }
     }
 }
 
-void Concrete01::compute_tension_backbone() {
-    const auto offset = trial_strain(0) - tension_origin;
+void Concrete01::compute_tension_backbone(const double t_strain, const double tension_origin, double& t_stress, double& t_stiffness) const {
+    const auto offset = t_strain - tension_origin;
     if(offset > crack_strain) {
         // cracking
-        trial_stress = d_factor / pow(offset, .4);
-        trial_stiffness = -.4 * trial_stress / offset;
+        t_stress = d_factor / pow(offset, .4);
+        t_stiffness = -.4 * t_stress / offset;
     } else {
         // elastic
-        trial_stiffness = initial_stiffness;
-        trial_stress = trial_stiffness * offset;
+        t_stiffness = initial_stiffness(0);
+        t_stress = t_stiffness * offset;
     }
 }
+
+Concrete01::Batch::Batch(const unsigned N, const Concrete01& P)
+    : MaterialBatch(N, P, P.current_history)
+    , material(P)
+    , backbone_flag(repmat(P.backbone_flag, 1, N)) {}
+
+unique_ptr<MaterialBatch> Concrete01::Batch::get_copy() { return make_unique<Batch>(*this); }
+
+int Concrete01::Batch::update_trial_status(const mat& t_strain) {
+    trial_strain = t_strain;
+
+    const auto t_epsilon = trial_strain.memptr();
+    const auto c_epsilon = current_strain.memptr();
+    const auto c_sigma = current_stress.memptr();
+    const auto c_stiffness = current_stiffness.memptr();
+    const auto t_sigma = trial_stress.memptr();
+    const auto t_stiffness = trial_stiffness.memptr();
+
+    for(unsigned I = 0; I < n_point; ++I) material.compute_trial_status(t_epsilon[I], c_epsilon[I], c_sigma[I], c_stiffness[I], current_history.colptr(I), t_sigma[I], t_stiffness[I], trial_history.colptr(I), backbone_flag.colptr(I));
+
+    return 0;
+}
+
+int Concrete01::Batch::clear_status() {
+    backbone_flag = repmat(vec{ 0., 1., 1., 0. }, 1, n_point);
+    return MaterialBatch::clear_status();
+}
+
+void Concrete01::Batch::save_status(vector<vec>& D) const {
+    MaterialBatch::save_status(D);
+    D.emplace_back(vectorise(backbone_flag));
+}
+
+void Concrete01::Batch::load_status(vector<vec>::const_iterator& D) {
+    MaterialBatch::load_status(D);
+    backbone_flag = reshape(*D++, size(backbone_flag));
+}
@@ -33,6 +33,8 @@
 enum class BackboneType { THORENFELDT, POPOVICS, TSAI, KPSC, KPSU };
 
 class Concrete01 : public Material1D {
+    class Batch;
+
     static const double crack_strain;
 
     const double peak_strain, peak_stress;
@@ -45,14 +47,12 @@ class Concrete01 : public Material1D {
 
     double M = 0., N = 0.;
 
-    double tension_origin = 0.;
-
-    bool on_compression_backbone = true;
-    bool on_tension_backbone = true;
-    bool first_tension = false;
+    // tension origin, on compression backbone, on tension backbone, first tension
+    vec4 backbone_flag{ 0., 1., 1., 0. };
 
-    void compute_compression_backbone();
-    void compute_tension_backbone();
+    void compute_compression_backbone(const double, double&, double&) const;
+    void compute_tension_backbone(const double, const double, double&, double&) const;
+    void compute_trial_status(const double, const double, const double, const double, const double*, double&, double&, double*, double*) const;
 
 public:
     Concrete01(const unsigned&, // tag
@@ -65,12 +65,16 @@ public:
     void initialize(const shared_ptr<DomainBase>&) override;
 
     unique_ptr<Material> get_copy() override;
+    unique_ptr<MaterialBatch> get_batch(const unsigned) override;
 
     int update_trial_status(const vec&) override;
 
     int clear_status() override;
     int commit_status() override;
     int reset_status() override;
+
+    void save_status(vector<vec>&) const override;
+    void load_status(vector<vec>::const_iterator&) override;
 };
 
 #endif
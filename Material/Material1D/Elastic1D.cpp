@@ -16,6 +16,18 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Elastic1D.h"
+#include <Material/MaterialBatch.h>
+
+class Elastic1D::Batch final : public MaterialBatch {
+    const double elastic_modulus;
+
+public:
+    Batch(const unsigned, const Elastic1D&);
+
+    unique_ptr<MaterialBatch> get_copy() override;
+
+    int update_trial_status(const mat&) override;
+};
 
 Elastic1D::Elastic1D(const unsigned& T, const double& E, const double& R)
     : Material1D(T, MT_ELASTIC1D, R)
@@ -29,6 +41,8 @@ void Elastic1D::initialize(const shared_ptr<DomainBase>&) {
 
 unique_ptr<Material> Elastic1D::get_copy() { return make_unique<Elastic1D>(*this); }
 
+unique_ptr<MaterialBatch> Elastic1D::get_batch(const unsigned N) { return make_unique<Batch>(N, *this); }
+
 int Elastic1D::update_trial_status(const vec& t_strain) {
     trial_strain = t_strain;
     if(trial_strain(0) == current_strain(0)) return 0;
@@ -61,3 +75,15 @@ void Elastic1D::print() {
     suanpan_info("Young's Modulus:\t%.3E.\n", elastic_modulus);
     suanpan_info("Current Strain: %.3E\tCurrent Stress: %.3E\n", current_strain(0), current_stress(0));
 }
+
+Elastic1D::Batch::Batch(const unsigned N, const Elastic1D& P)
+    : MaterialBatch(N, P)
+    , elastic_modulus(P.elastic_modulus) {}
+
+unique_ptr<MaterialBatch> Elastic1D::Batch::get_copy() { return make_unique<Batch>(*this); }
+
+int Elastic1D::Batch::update_trial_status(const mat& t_strain) {
+    trial_strain = t_strain;
+    trial_stress = elastic_modulus * trial_strain;
+    return 0;
+}
@@ -30,6 +30,8 @@
 #include <Material/Material1D/Material1D.h>
 
 class Elastic1D : public Material1D {
+    class Batch;
+
     const double elastic_modulus; /**< elastic modulus */
 public:
     explicit Elastic1D(const unsigned& = 0, const double& = 2E5, const double& = 0.);
@@ -37,6 +39,7 @@ public:
     void initialize(const shared_ptr<DomainBase>&) override;
 
     unique_ptr<Material> get_copy() override;
+    unique_ptr<MaterialBatch> get_batch(const unsigned) override;
 
     int update_trial_status(const vec&) override;
 
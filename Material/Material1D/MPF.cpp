@@ -16,8 +16,20 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "MPF.h"
+#include <Material/MaterialBatch.h>
 #include <Toolbox/utility.h>
 
+class MPF::Batch final : public MaterialBatch {
+    const MPF material;
+
+public:
+    Batch(const unsigned, const MPF&);
+
+    unique_ptr<MaterialBatch> get_copy() override;
+
+    int update_trial_status(const mat&) override;
+};
+
 MPF::MPF(const unsigned T, const double E, const double Y, const double H, const double R, const double B1, const double B2, const double B3, const double B4, const bool ISO, const bool CON, const double D)
     : Material1D(T, MT_MPF, D)
     , elastic_modulus(E)
@@ -44,39 +56,79 @@ void MPF::initialize(const shared_ptr<DomainBase>&) {
 
 unique_ptr<Material> MPF::get_copy() { return make_unique<MPF>(*this); }
 
+unique_ptr<MaterialBatch> MPF::get_batch(const unsigned N) { return make_unique<Batch>(N, *this); }
+
 int MPF::update_trial_status(const vec& t_strain) {
     trial_strain = t_strain;
-    incre_strain = trial_strain - current_strain;
+
+    compute_trial_status(trial_strain(0), current_strain(0), current_stress(0), current_history.memptr(), trial_stress(0), trial_stiffness(0), trial_history.memptr());
+
+    return 0;
+}
+
+int MPF::clear_status() {
+    current_strain.zeros();
+    current_stress.zeros();
+    current_stiffness = initial_stiffness;
+    current_history.zeros();
+    current_history(2) = yield_stress;
+    current_history(3) = yield_strain;
+    return reset_status();
+}
+
+int MPF::commit_status() {
+    current_strain = trial_strain;
+    current_stress = trial_stress;
+    current_stiffness = trial_stiffness;
+    current_history = trial_history;
+    return 0;
+}
+
+int MPF::reset_status() {
+    trial_strain = current_strain;
+    trial_stress = current_stress;
+    trial_stiffness = current_stiffness;
+    return 0;
+}
+
+void MPF::print() {
+    suanpan_info("Menegotto--Pinto--Filippou model with initial stiffness %.3E and yield stress %.3E.\n", elastic_modulus, yield_stress);
+    suanpan_info("Current Strain: %.3E\tCurrent Stress: %.3E\n", current_strain(0), current_stress(0));
+}
+
+// shared by the material object and the batch, the trial status is left untouched if the strain does not change
+void MPF::compute_trial_status(const double t_strain, const double c_strain, const double c_stress, const double* c_history, double& t_stress, double& t_stiffness, double* t_history) const {
+    const auto incre_strain = t_strain - c_strain;
 
     // quick return is important not only for performance but also for forbidding updating the history data
-    if(incre_strain(0) == 0.) return 0;
+    if(incre_strain == 0.) return;
 
-    trial_history = current_history;
-    auto& reverse_stress = trial_history(0);
-    auto& reverse_strain = trial_history(1);
-    auto& inter_stress = trial_history(2);
-    auto& inter_strain = trial_history(3);
-    auto& pre_inter_strain = trial_history(4);
-    auto& max_strain = trial_history(5);
-    auto& load_sign = trial_history(6);
+    std::copy(c_history, c_history + 7, t_history);
+    auto& reverse_stress = t_history[0];
+    auto& reverse_strain = t_history[1];
+    auto& inter_stress = t_history[2];
+    auto& inter_strain = t_history[3];
+    auto& pre_inter_strain = t_history[4];
+    auto& max_strain = t_history[5];
+    auto& load_sign = t_history[6];
 
     auto shift_stress = 0.;
     if(isotropic_hardening) {
         shift_stress = A3 * yield_stress * (max_strain / yield_strain - A4);
         if(shift_stress < 0.) shift_stress = 0.;
-        const auto trial_max_strain = abs(trial_strain(0));
+        const auto trial_max_strain = abs(t_strain);
         if(trial_max_strain > max_strain) max_strain = trial_max_strain;
     }
 
-    const auto trial_load_sign = suanpan::sign(incre_strain(0));
+    const auto trial_load_sign = suanpan::sign(incre_strain);
 
     auto R = R0;
 
     if(load_sign != 0.) {
         // double check of current load sign
         if(trial_load_sign != 0. && trial_load_sign != load_sign) {
-            reverse_stress = current_stress(0);
-            reverse_strain = current_strain(0);
+            reverse_stress = c_stress;
+            reverse_strain = c_strain;
             pre_inter_strain = inter_strain;
             inter_strain = yield_strain * hardening_ratio * elastic_modulus - yield_stress - shift_stress;
             if(trial_load_sign > 0.) inter_strain = -inter_strain;
@@ -93,44 +145,32 @@ int MPF::update_trial_status(const vec& t_strain) {
     if(trial_load_sign != 0. && trial_load_sign != load_sign) load_sign = trial_load_sign;
 
     const auto tmp_a = inter_strain - reverse_strain;
-    const auto normal_strain = (trial_strain(0) - reverse_strain) / tmp_a;
+    const auto normal_strain = (t_strain - reverse_strain) / tmp_a;
     const auto tmp_b = 1. + pow(normal_strain, R);
     const auto tmp_c = (1. - hardening_ratio) / pow(tmp_b, 1. / R);
     const auto normal_stress = (hardening_ratio + tmp_c) * normal_strain;
     const auto tmp_d = inter_stress - reverse_stress;
 
-    trial_stress = normal_stress * tmp_d + reverse_stress;
-    trial_stiffness = tmp_d / tmp_a * (hardening_ratio + tmp_c / tmp_b);
-
-    return 0;
+    t_stress = normal_stress * tmp_d + reverse_stress;
+    t_stiffness = tmp_d / tmp_a * (hardening_ratio + tmp_c / tmp_b);
 }
 
-int MPF::clear_status() {
-    current_strain.zeros();
-    current_stress.zeros();
-    current_stiffness = initial_stiffness;
-    current_history.zeros();
-    current_history(2) = yield_stress;
-    current_history(3) = yield_strain;
-    return reset_status();
-}
+MPF::Batch::Batch(const unsigned N, const MPF& P)
+    : MaterialBatch(N, P, P.current_history)
+    , material(P) {}
 
-int MPF::commit_status() {
-    current_strain = trial_strain;
-    current_stress = trial_stress;
-    current_stiffness = trial_stiffness;
-    current_history = trial_history;
-    return 0;
-}
+unique_ptr<MaterialBatch> MPF::Batch::get_copy() { return make_unique<Batch>(*this); }
 
-int MPF::reset_status() {
-    trial_strain = current_strain;
-    trial_stress = current_stress;
-    trial_stiffness = current_stiffness;
-    return 0;
-}
+int MPF::Batch::update_trial_status(const mat& t_strain) {
+    trial_strain = t_strain;
 
-void MPF::print() {
-    suanpan_info("Menegotto--Pinto--Filippou model with initial stiffness %.3E and yield stress %.3E.\n", elastic_modulus, yield_stress);
-    suanpan_info("Current Strain: %.3E\tCurrent Stress: %.3E\n", current_strain(0), current_stress(0));
+    const auto t_epsilon = trial_strain.memptr();
+    const auto c_epsilon = current_strain.memptr();
+    const auto c_sigma = current_stress.memptr();
+    const auto t_sigma = trial_stress.memptr();
+    const auto t_stiffness = trial_stiffness.memptr();
+
+    for(unsigned I = 0; I < n_point; ++I) material.compute_trial_status(t_epsilon[I], c_epsilon[I], c_sigma[I], current_history.colptr(I), t_sigma[I], t_stiffness[I], trial_history.colptr(I));
+
+    return 0;
 }
@@ -31,6 +31,8 @@
 #include <Material/Material1D/Material1D.h>
 
 class MPF final : public Material1D {
+    class Batch;
+
     const double elastic_modulus;    // elastic modulus
     const double yield_stress;       // yield stress
     const double hardening_ratio;    // hardening ratio
@@ -41,6 +43,8 @@ class MPF final : public Material1D {
 
     const double yield_strain; // yield strain
 
+    void compute_trial_status(const double, const double, const double, const double*, double&, double&, double*) const;
+
 public:
     explicit MPF(const unsigned = 0, // tag
         const double = 2E5,          // elastic modulus
@@ -59,6 +63,7 @@ public:
     void initialize(const shared_ptr<DomainBase>&) override;
 
     unique_ptr<Material> get_copy() override;
+    unique_ptr<MaterialBatch> get_batch(const unsigned) override;
 
     int update_trial_status(const vec&) override;
 
@@ -16,8 +16,32 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Bilinear2D.h"
+#include <Material/MaterialBatch.h>
 #include <array>
 
+class Bilinear2D::Batch final : public MaterialBatch {
+    const PlaneType plane_type;
+
+    mat trial_full_strain;
+
+    unique_ptr<MaterialBatch> base;
+
+public:
+    Batch(const unsigned, Bilinear2D&);
+    Batch(const Batch&);
+
+    unique_ptr<MaterialBatch> get_copy() override;
+
+    int update_trial_status(const mat&) override;
+
+    int clear_status() override;
+    int commit_status() override;
+    int reset_status() override;
+
+    void save_status(vector<vec>&) const override;
+    void load_status(vector<vec>::const_iterator&) override;
+};
+
 const array<unsigned, 3> Bilinear2D::F = { 0, 1, 3 };
 
 Bilinear2D::Bilinear2D(const unsigned& T, const double& E, const double& V, const double& Y, const double& H, const double& B, const PlaneType& M, const double& D)
@@ -49,6 +73,8 @@ double Bilinear2D::get_parameter(const ParameterType& T) const { return base.get
 
 unique_ptr<Material> Bilinear2D::get_copy() { return make_unique<Bilinear2D>(*this); }
 
+unique_ptr<MaterialBatch> Bilinear2D::get_batch(const unsigned N) { return make_unique<Batch>(N, *this); }
+
 int Bilinear2D::update_trial_status(const vec& t_strain) {
     trial_strain = t_strain;
 
@@ -117,3 +143,97 @@ int Bilinear2D::reset_status() {
 
     return base.reset_status();
 }
+
+void Bilinear2D::save_status(vector<vec>& D) const {
+    Material::save_status(D);
+    base.save_status(D);
+}
+
+void Bilinear2D::load_status(vector<vec>::const_iterator& D) {
+    Material::load_status(D);
+    base.load_status(D);
+}
+
+Bilinear2D::Batch::Batch(const unsigned N, Bilinear2D& P)
+    : MaterialBatch(N, P)
+    , plane_type(P.plane_type)
+    , trial_full_strain(repmat(P.trial_full_strain, 1, N))
+    , base(P.base.get_batch(N)) {}
+
+Bilinear2D::Batch::Batch(const Batch& old_obj)
+    : MaterialBatch(old_obj)
+    , plane_type(old_obj.plane_type)
+    , trial_full_strain(old_obj.trial_full_strain)
+    , base(old_obj.base->get_copy()) {}
+
+unique_ptr<MaterialBatch> Bilinear2D::Batch::get_copy() { return make_unique<Batch>(*this); }
+
+// the plane stress condition is iterated on the whole batch, converged points are updated with the same strain and remain unchanged
+int Bilinear2D::Batch::update_trial_status(const mat& t_strain) {
+    trial_strain = t_strain;
+
+    for(auto I = 0; I < 3; ++I) trial_full_strain.row(F[I]) = trial_strain.row(I);
+
+    base->update_trial_status(trial_full_strain);
+
+    auto& t_stress = base->get_stress();
+    auto& t_stiffness = base->get_stiffness();
+
+    // PLANE STRESS
+    if(plane_type == PlaneType::S) {
+        auto counter = 0;
+        while(true) {
+            const uvec active = find(abs(t_stress.row(2)) >= 1E-10);
+            if(active.is_empty()) break;
+            if(++counter > 20) {
+                suanpan_warning("cannot converge in 20 iterations.\n");
+                break;
+            }
+            for(const auto& J : active) trial_full_strain(2, J) -= t_stress(2, J) / t_stiffness(14, J);
+            base->update_trial_status(trial_full_strain);
+        }
+    }
+
+    for(unsigned J = 0; J < n_point; ++J) {
+        const mat66 full_stiffness(t_stiffness.colptr(J));
+        mat reduced_stiffness(trial_stiffness.colptr(J), 3, 3, false, true);
+        for(auto I = 0; I < 3; ++I) trial_stress(I, J) = t_stress(F[I], J);
+        for(auto I = 0; I < 3; ++I)
+            for(auto K = 0; K < 3; ++K) reduced_stiffness(I, K) = full_stiffness(F[I], F[K]);
+        if(plane_type == PlaneType::S) {
+            if(full_stiffness(2, 2) != 0.) {
+                for(auto I = 0; I < 3; ++I)
+                    for(auto K = 0; K < 3; ++K) reduced_stiffness(I, K) -= full_stiffness(F[I], 2) * full_stiffness(2, F[K]) / full_stiffness(2, 2);
+            } else
+                suanpan_error("K(2,2)=0.\n");
+        }
+    }
+
+    return 0;
+}
+
+int Bilinear2D::Batch::clear_status() {
+    trial_full_strain.zeros();
+    MaterialBatch::clear_status();
+    return base->clear_status();
+}
+
+int Bilinear2D::Batch::commit_status() {
+    MaterialBatch::commit_status();
+    return base->commit_status();
+}
+
+int Bilinear2D::Batch::reset_status() {
+    MaterialBatch::reset_status();
+    return base->reset_status();
+}
+
+void Bilinear2D::Batch::save_status(vector<vec>& D) const {
+    MaterialBatch::save_status(D);
+    base->save_status(D);
+}
+
+void Bilinear2D::Batch::load_status(vector<vec>::const_iterator& D) {
+    MaterialBatch::load_status(D);
+    base->load_status(D);
+}
@@ -34,6 +34,8 @@
 using std::array;
 
 class Bilinear2D : public Material2D {
+    class Batch;
+
     static const array<unsigned, 3> F;
 
     vec trial_full_strain;
@@ -56,12 +58,16 @@ public:
     double get_parameter(const ParameterType& = ParameterType::DENSITY) const override;
 
     unique_ptr<Material> get_copy() override;
+    unique_ptr<MaterialBatch> get_batch(const unsigned) override;
 
     int update_trial_status(const vec&) override;
 
     int clear_status() override;
     int commit_status() override;
     int reset_status() override;
+
+    void save_status(vector<vec>&) const override;
+    void load_status(vector<vec>::const_iterator&) override;
 };
 
 #endif
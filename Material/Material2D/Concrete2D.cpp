@@ -141,3 +141,15 @@ int Concrete2D::reset_status() {
     code += concrete_minor->reset_status();
     return code;
 }
+
+void Concrete2D::save_status(vector<vec>& D) const {
+    Material::save_status(D);
+    concrete_major->save_status(D);
+    concrete_minor->save_status(D);
+}
+
+void Concrete2D::load_status(vector<vec>::const_iterator& D) {
+    Material::load_status(D);
+    concrete_major->load_status(D);
+    concrete_minor->load_status(D);
+}
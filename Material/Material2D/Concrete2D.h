@@ -58,6 +58,9 @@ public:
     int clear_status() override;
     int commit_status() override;
     int reset_status() override;
+
+    void save_status(vector<vec>&) const override;
+    void load_status(vector<vec>::const_iterator&) override;
 };
 
 #endif
@@ -168,3 +168,17 @@ int DSFM::reset_status() {
     code += concrete_minor->reset_status();
     return code;
 }
+
+void DSFM::save_status(vector<vec>& D) const {
+    Material::save_status(D);
+    rebar->save_status(D);
+    concrete_major->save_status(D);
+    concrete_minor->save_status(D);
+}
+
+void DSFM::load_status(vector<vec>::const_iterator& D) {
+    Material::load_status(D);
+    rebar->load_status(D);
+    concrete_major->load_status(D);
+    concrete_minor->load_status(D);
+}
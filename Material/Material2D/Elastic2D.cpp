@@ -16,8 +16,18 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Elastic2D.h"
+#include <Material/MaterialBatch.h>
 #include <Recorder/OutputType.h>
 
+class Elastic2D::Batch final : public MaterialBatch {
+public:
+    Batch(const unsigned, const Elastic2D&);
+
+    unique_ptr<MaterialBatch> get_copy() override;
+
+    int update_trial_status(const mat&) override;
+};
+
 Elastic2D::Elastic2D(const unsigned& T, const double& E, const double& P, const double& R, const PlaneType& PT)
     : Material2D(T, MT_ELASTIC2D, PT, R)
     , elastic_modulus(E)
@@ -39,6 +49,8 @@ void Elastic2D::initialize(const shared_ptr<DomainBase>&) {
 
 unique_ptr<Material> Elastic2D::get_copy() { return make_unique<Elastic2D>(*this); }
 
+unique_ptr<MaterialBatch> Elastic2D::get_batch(const unsigned N) { return make_unique<Batch>(N, *this); }
+
 int Elastic2D::update_trial_status(const vec& t_strain) {
     trial_strain = t_strain;
     trial_stress = trial_stiffness * trial_strain;
@@ -111,3 +123,15 @@ vector<vec> Elastic2D::record(const OutputType& P) {
 
     return output;
 }
+
+Elastic2D::Batch::Batch(const unsigned N, const Elastic2D& P)
+    : MaterialBatch(N, P) {}
+
+unique_ptr<MaterialBatch> Elastic2D::Batch::get_copy() { return make_unique<Batch>(*this); }
+
+// the stiffness is constant so that all points are updated by one matrix product
+int Elastic2D::Batch::update_trial_status(const mat& t_strain) {
+    trial_strain = t_strain;
+    trial_stress = initial_stiffness * trial_strain;
+    return 0;
+}
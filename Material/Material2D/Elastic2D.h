@@ -36,6 +36,8 @@
 #include <Material/Material2D/Material2D.h>
 
 class Elastic2D : public Material2D {
+    class Batch;
+
     const double elastic_modulus; // elastic modulus
     const double poissons_ratio;  // poissons ratio
 public:
@@ -44,6 +46,7 @@ public:
     void initialize(const shared_ptr<DomainBase>&) override;
 
     unique_ptr<Material> get_copy() override;
+    unique_ptr<MaterialBatch> get_batch(const unsigned) override;
 
     int update_trial_status(const vec&) override;
 
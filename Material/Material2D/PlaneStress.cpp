@@ -125,3 +125,15 @@ int PlaneStress::reset_status() {
     Material::reset_status();
     return base->reset_status();
 }
+
+void PlaneStress::save_status(vector<vec>& D) const {
+    Material::save_status(D);
+    D.emplace_back(current_full_strain);
+    base->save_status(D);
+}
+
+void PlaneStress::load_status(vector<vec>::const_iterator& D) {
+    Material::load_status(D);
+    current_full_strain = *D++;
+    base->load_status(D);
+}
@@ -115,3 +115,15 @@ int RC01::reset_status() {
     code += concrete->reset_status();
     return code;
 }
+
+void RC01::save_status(vector<vec>& D) const {
+    Material::save_status(D);
+    rebar->save_status(D);
+    concrete->save_status(D);
+}
+
+void RC01::load_status(vector<vec>::const_iterator& D) {
+    Material::load_status(D);
+    rebar->load_status(D);
+    concrete->load_status(D);
+}
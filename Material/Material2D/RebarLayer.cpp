@@ -138,3 +138,15 @@ int RebarLayer::reset_status() {
     code += rebar_minor->reset_status();
     return code;
 }
+
+void RebarLayer::save_status(vector<vec>& D) const {
+    Material::save_status(D);
+    rebar_major->save_status(D);
+    rebar_minor->save_status(D);
+}
+
+void RebarLayer::load_status(vector<vec>::const_iterator& D) {
+    Material::load_status(D);
+    rebar_major->load_status(D);
+    rebar_minor->load_status(D);
+}
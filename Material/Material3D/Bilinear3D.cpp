@@ -16,11 +16,23 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Bilinear3D.h"
+#include <Material/MaterialBatch.h>
 #include <Toolbox/tensorToolbox.h>
 
+class Bilinear3D::Batch final : public MaterialBatch {
+    const Bilinear3D material;
+
+public:
+    Batch(const unsigned, const Bilinear3D&);
+
+    unique_ptr<MaterialBatch> get_copy() override;
+
+    int update_trial_status(const mat&) override;
+};
+
 const vec Bilinear3D::norm_weight = vec(std::initializer_list<double>{ 1., 1., 1., 2., 2., 2. });
 const double Bilinear3D::root_two_third = sqrt(2. / 3.);
-const mat Bilinear3D::unit_dev_tensor = tensor::unit_deviatoric_tensor4();
+const mat66 Bilinear3D::unit_dev_tensor = tensor::unit_deviatoric_tensor4();
 
 Bilinear3D::Bilinear3D(const unsigned T, const double E, const double V, const double Y, const double H, const double B, const double R)
     : Material3D(T, MT_BILINEAR3D, R)
@@ -51,42 +63,19 @@ void Bilinear3D::initialize(const shared_ptr<DomainBase>&) {
 
     current_stiffness = trial_stiffness = initial_stiffness;
 
-    current_back_stress.zeros(6);
-    trial_back_stress.zeros(6);
-
-    current_plastic_strain = trial_plastic_strain = 0.;
+    // plastic strain and back stress
+    current_history.zeros(7);
+    trial_history.zeros(7);
 }
 
 unique_ptr<Material> Bilinear3D::get_copy() { return make_unique<Bilinear3D>(*this); }
 
-int Bilinear3D::update_trial_status(const vec& t_strain) {
-    trial_plastic_strain = current_plastic_strain;
-    trial_back_stress = current_back_stress;
-    trial_stiffness = initial_stiffness;
+unique_ptr<MaterialBatch> Bilinear3D::get_batch(const unsigned N) { return make_unique<Batch>(N, *this); }
 
+int Bilinear3D::update_trial_status(const vec& t_strain) {
     trial_strain = t_strain;
-    incre_strain = trial_strain - current_strain;
-    trial_stress = current_stress + trial_stiffness * incre_strain;
-
-    const vec shifted_stress = tensor::dev(trial_stress) - trial_back_stress;
-
-    const auto norm_shifted_stress = sqrt(dot(norm_weight, square(shifted_stress)));
-
-    const auto yield_func = norm_shifted_stress - root_two_third * (yield_stress + factor_b * trial_plastic_strain);
 
-    if(yield_func > tolerance) {
-        const auto tmp_a = double_shear + factor_a;
-        const auto gamma = yield_func / tmp_a;
-        const vec unit_norm = shifted_stress / norm_shifted_stress;
-        const vec tmp_b = gamma * unit_norm;
-        const auto tmp_c = square_double_shear * gamma / norm_shifted_stress;
-
-        trial_stress -= double_shear * tmp_b;
-        trial_back_stress += factor_a * beta * tmp_b;
-        trial_plastic_strain += root_two_third * gamma;
-
-        trial_stiffness += (tmp_c - square_double_shear / tmp_a) * unit_norm * unit_norm.t() - tmp_c * unit_dev_tensor;
-    }
+    compute_trial_status(trial_strain.memptr(), current_strain.memptr(), current_stress.memptr(), current_history.memptr(), trial_stress.memptr(), trial_stiffness.memptr(), trial_history.memptr());
 
     return 0;
 }
@@ -95,8 +84,7 @@ int Bilinear3D::clear_status() {
     current_strain.zeros();
     current_stress.zeros();
     current_stiffness = initial_stiffness;
-    current_back_stress.zeros();
-    current_plastic_strain = 0.;
+    current_history.zeros();
     return reset_status();
 }
 
@@ -104,8 +92,7 @@ int Bilinear3D::commit_status() {
     current_strain = trial_strain;
     current_stress = trial_stress;
     current_stiffness = trial_stiffness;
-    current_back_stress = trial_back_stress;
-    current_plastic_strain = trial_plastic_strain;
+    current_history = trial_history;
     return 0;
 }
 
@@ -113,7 +100,56 @@ int Bilinear3D::reset_status() {
     trial_strain = current_strain;
     trial_stress = current_stress;
     trial_stiffness = current_stiffness;
-    trial_back_stress = current_back_stress;
-    trial_plastic_strain = current_plastic_strain;
+    trial_history = current_history;
+    return 0;
+}
+
+// shared by the material object and the batch, all arguments point to the first entry of the corresponding quantity
+void Bilinear3D::compute_trial_status(const double* t_strain, const double* c_strain, const double* c_stress, const double* c_history, double* t_stress, double* t_stiffness, double* t_history) const {
+    std::copy(c_history, c_history + 7, t_history);
+
+    auto& plastic_strain = t_history[0];
+    vec back_stress(t_history + 1, 6, false, true);
+    vec stress(t_stress, 6, false, true);
+    mat stiffness(t_stiffness, 6, 6, false, true);
+
+    stiffness = initial_stiffness;
+
+    stress = vec6(c_stress) + stiffness * (vec6(t_strain) - vec6(c_strain));
+
+    const vec6 shifted_stress = tensor::dev(stress) - back_stress;
+
+    const auto norm_shifted_stress = sqrt(dot(norm_weight, square(shifted_stress)));
+
+    const auto yield_func = norm_shifted_stress - root_two_third * (yield_stress + factor_b * plastic_strain);
+
+    if(yield_func > tolerance) {
+        const auto tmp_a = double_shear + factor_a;
+        const auto gamma = yield_func / tmp_a;
+        const vec6 unit_norm = shifted_stress / norm_shifted_stress;
+        const vec6 tmp_b = gamma * unit_norm;
+        const auto tmp_c = square_double_shear * gamma / norm_shifted_stress;
+
+        stress -= double_shear * tmp_b;
+        back_stress += factor_a * beta * tmp_b;
+        plastic_strain += root_two_third * gamma;
+
+        // the outer product is evaluated into a fixed size matrix to avoid a heap temporary
+        const mat66 t_tangent = (tmp_c - square_double_shear / tmp_a) * unit_norm * unit_norm.t();
+        stiffness += t_tangent - tmp_c * unit_dev_tensor;
+    }
+}
+
+Bilinear3D::Batch::Batch(const unsigned N, const Bilinear3D& P)
+    : MaterialBatch(N, P, P.current_history)
+    , material(P) {}
+
+unique_ptr<MaterialBatch> Bilinear3D::Batch::get_copy() { return make_unique<Batch>(*this); }
+
+int Bilinear3D::Batch::update_trial_status(const mat& t_strain) {
+    trial_strain = t_strain;
+
+    for(unsigned I = 0; I < n_point; ++I) material.compute_trial_status(trial_strain.colptr(I), current_strain.colptr(I), current_stress.colptr(I), current_history.colptr(I), trial_stress.colptr(I), trial_stiffness.colptr(I), trial_history.colptr(I));
+
     return 0;
 }
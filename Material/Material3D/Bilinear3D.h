@@ -31,9 +31,11 @@
 #include <Material/Material3D/Material3D.h>
 
 class Bilinear3D : public Material3D {
+    class Batch;
+
     static const vec norm_weight;
     static const double root_two_third;
-    static const mat unit_dev_tensor;
+    static const mat66 unit_dev_tensor;
 
     const double elastic_modulus; /**< elastic modulus */
     const double poissons_ratio;  /**< poisson's ratio */
@@ -50,11 +52,7 @@ class Bilinear3D : public Material3D {
 
     const double factor_a, factor_b;
 
-    double current_plastic_strain = 0.;
-    double trial_plastic_strain = 0.;
-
-    vec current_back_stress;
-    vec trial_back_stress;
+    void compute_trial_status(const double*, const double*, const double*, const double*, double*, double*, double*) const;
 
 public:
     explicit Bilinear3D(const unsigned = 0, /**< tag */
@@ -68,6 +66,7 @@ public:
     void initialize(const shared_ptr<DomainBase>& = nullptr) override;
 
     unique_ptr<Material> get_copy() override;
+    unique_ptr<MaterialBatch> get_batch(const unsigned) override;
 
     int update_trial_status(const vec&) override;
 
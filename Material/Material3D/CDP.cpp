@@ -20,8 +20,8 @@
 
 const double CDP::sqrt_three_over_two = sqrt(1.5);
 
-vec CDP::compute_backbone(const double f, const double a, const double cb, const double kappa) {
-    vec out(6);
+vec6 CDP::compute_backbone(const double f, const double a, const double cb, const double kappa) {
+    vec6 out;
 
     const auto s_phi = sqrt(1. + a * (a + 2.) * kappa);
     const auto t_phi = (1. + .5 * a) / s_phi;
@@ -38,10 +38,10 @@ vec CDP::compute_backbone(const double f, const double a, const double cb, const
     return out;
 }
 
-vec CDP::compute_d_weight(const vec& in) {
+vec3 CDP::compute_d_weight(const vec& in) {
     const auto abs_sum = accu(abs(in));
 
-    vec out(3);
+    vec3 out;
 
     out.fill(abs_sum);
 
@@ -53,8 +53,8 @@ vec CDP::compute_d_weight(const vec& in) {
     return out;
 }
 
-mat CDP::compute_jacobian_nominal_to_principal(const mat& in) {
-    mat out(3, 6);
+mat::fixed<3, 6> CDP::compute_jacobian_nominal_to_principal(const mat& in) {
+    mat::fixed<3, 6> out;
 
     out(span(0, 2), span(0, 2)) = square(in).t();
 
@@ -67,8 +67,8 @@ mat CDP::compute_jacobian_nominal_to_principal(const mat& in) {
     return out;
 }
 
-mat CDP::compute_jacobian_principal_to_nominal(const mat& in) {
-    mat out(6, 3);
+mat::fixed<6, 3> CDP::compute_jacobian_principal_to_nominal(const mat& in) {
+    mat::fixed<6, 3> out;
 
     out(span(0, 2), span(0, 2)) = square(in);
 
@@ -146,18 +146,18 @@ int CDP::update_trial_status(const vec& t_strain) {
     trial_stress = initial_stiffness * (trial_strain - trial_plastic_strain);
 
     // principal predictor \hat{\sigma}^{tr}
-    vec p_predictor;
-    mat trans_mat;
+    vec3 p_predictor;
+    mat33 trans_mat;
     if(!eig_sym(p_predictor, trans_mat, tensor::stress::to_tensor(trial_stress))) return -1;
 
     // deviatoric principal predictor \hat{s}^{tr}
-    const vec d_predictor = p_predictor - mean(p_predictor);
+    const vec3 d_predictor = p_predictor - mean(p_predictor);
     // unit deviatoric principal predictor \hat{n}
-    const vec u_predictor = d_predictor / norm(d_predictor);
+    const vec3 u_predictor = d_predictor / norm(d_predictor);
 
-    const vec c_dfdsigma = sqrt_three_over_two * u_predictor + alpha;
-    const vec dsigmadlambda = -double_shear * u_predictor - factor_a;
-    const vec dgdsigma = u_predictor + alpha_p;
+    const vec3 c_dfdsigma = sqrt_three_over_two * u_predictor + alpha;
+    const vec3 dsigmadlambda = -double_shear * u_predictor - factor_a;
+    const vec3 dgdsigma = u_predictor + alpha_p;
 
     const auto const_t = dgdsigma(2) / g_t;
     const auto const_c = dgdsigma(0) / g_c;
@@ -168,7 +168,7 @@ int CDP::update_trial_status(const vec& t_strain) {
     auto c_para = compute_backbone(f_c, a_c, cb_c, kappa_c);
 
     // effective stress \hat{\bar{\sigma}}
-    auto e_stress = p_predictor;
+    vec3 e_stress = p_predictor;
 
     auto beta = e_stress(2) > 0. ? -c_para(2) / t_para(2) * factor_c - 1. - alpha : 0.;
 
@@ -185,8 +185,10 @@ int CDP::update_trial_status(const vec& t_strain) {
         return 0;
     }
 
-    vec dfdsigma = c_dfdsigma, dfdkappa(2), h(2);
-    mat phpkappa(2, 2), phpsigma, dqdkappa;
+    vec3 dfdsigma = c_dfdsigma;
+    vec2 dfdkappa, h;
+    mat22 phpkappa, dqdkappa;
+    mat::fixed<2, 3> phpsigma;
 
     auto p_lambda = 0.;
 
@@ -226,7 +228,7 @@ int CDP::update_trial_status(const vec& t_strain) {
         if(r_weight != 0.) phpkappa(0, 0) = r_weight * t_para(4) * const_t;
         if(r_weight != 1.) phpkappa(1, 1) = (1. - r_weight) * c_para(4) * const_c;
 
-        phpsigma = vec{ t_para(1) * const_t, -c_para(1) * const_c } * compute_d_weight(e_stress).t();
+        phpsigma = vec2{ t_para(1) * const_t, -c_para(1) * const_c } * compute_d_weight(e_stress).t();
 
         dqdkappa = i_lambda * phpkappa - eye(2, 2) - (i_lambda * phpsigma * dsigmadlambda + h) * dfdkappa.t() / dot(dfdsigma, dsigmadlambda);
 
@@ -248,7 +250,7 @@ int CDP::update_trial_status(const vec& t_strain) {
     }
 
     const auto d_stress = tensor::dev(trial_stress);
-    const vec n = d_stress / tensor::norm(d_stress);
+    const vec6 n = d_stress / tensor::norm(d_stress);
     trial_plastic_strain += p_lambda * (n + unit_alpha_p);
     trial_stress = tensor::stress::to_voigt(trans_mat * diagmat(e_stress) * trans_mat.t());
     trial_stress *= (1. - c_para(0)) * (1. - r_weight * t_para(0));
@@ -284,3 +286,13 @@ int CDP::reset_status() {
     trial_stiffness = current_stiffness;
     return 0;
 }
+
+void CDP::save_status(vector<vec>& D) const {
+    Material::save_status(D);
+    D.emplace_back(current_plastic_strain);
+}
+
+void CDP::load_status(vector<vec>::const_iterator& D) {
+    Material::load_status(D);
+    current_plastic_strain = *D++;
+}
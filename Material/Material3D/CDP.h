@@ -44,10 +44,10 @@ class CDP : public Material3D {
 
     mat inv_stiffness;
 
-    static vec compute_backbone(const double, const double, const double, const double);
-    static vec compute_d_weight(const vec&);
-    static mat compute_jacobian_nominal_to_principal(const mat&);
-    static mat compute_jacobian_principal_to_nominal(const mat&);
+    static vec6 compute_backbone(const double, const double, const double, const double);
+    static vec3 compute_d_weight(const vec&);
+    static mat::fixed<3, 6> compute_jacobian_nominal_to_principal(const mat&);
+    static mat::fixed<6, 3> compute_jacobian_principal_to_nominal(const mat&);
     static double compute_weight(const vec&);
 
 public:
@@ -78,6 +78,9 @@ public:
     int clear_status() override;
     int commit_status() override;
     int reset_status() override;
+
+    void save_status(vector<vec>&) const override;
+    void load_status(vector<vec>::const_iterator&) override;
 };
 
 #endif
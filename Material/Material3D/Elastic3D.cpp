@@ -16,6 +16,16 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Elastic3D.h"
+#include <Material/MaterialBatch.h>
+
+class Elastic3D::Batch final : public MaterialBatch {
+public:
+    Batch(const unsigned, const Elastic3D&);
+
+    unique_ptr<MaterialBatch> get_copy() override;
+
+    int update_trial_status(const mat&) override;
+};
 
 Elastic3D::Elastic3D(const unsigned T, const double E, const double P, const double R)
     : Material3D(T, MT_ELASTIC3D, R)
@@ -40,6 +50,8 @@ void Elastic3D::initialize(const shared_ptr<DomainBase>&) {
 
 unique_ptr<Material> Elastic3D::get_copy() { return make_unique<Elastic3D>(*this); }
 
+unique_ptr<MaterialBatch> Elastic3D::get_batch(const unsigned N) { return make_unique<Batch>(N, *this); }
+
 int Elastic3D::update_trial_status(const vec& t_strain) {
     trial_strain = t_strain;
     trial_stress = trial_stiffness * trial_strain;
@@ -69,3 +81,15 @@ int Elastic3D::reset_status() {
 }
 
 void Elastic3D::print() { suanpan_info("Isotropic Elastic Material.\n"); }
+
+Elastic3D::Batch::Batch(const unsigned N, const Elastic3D& P)
+    : MaterialBatch(N, P) {}
+
+unique_ptr<MaterialBatch> Elastic3D::Batch::get_copy() { return make_unique<Batch>(*this); }
+
+// the stiffness is constant so that all points are updated by one matrix product
+int Elastic3D::Batch::update_trial_status(const mat& t_strain) {
+    trial_strain = t_strain;
+    trial_stress = initial_stiffness * trial_strain;
+    return 0;
+}
@@ -34,6 +34,8 @@
 #include <Material/Material3D/Material3D.h>
 
 class Elastic3D : public Material3D {
+    class Batch;
+
     double elastic_modulus; /**< elastic modulus */
     double poissons_ratio;  /**< poissons ratio */
 
@@ -43,6 +45,7 @@ public:
     void initialize(const shared_ptr<DomainBase>&) override;
 
     unique_ptr<Material> get_copy() override;
+    unique_ptr<MaterialBatch> get_batch(const unsigned) override;
 
     int update_trial_status(const vec&) override;
 
@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Theodore Chang
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "MaterialBatch.h"
+
+MaterialBatch::MaterialBatch(const unsigned N, const Material& P, const vec& H)
+    : n_point(N)
+    , density(P.get_parameter(ParameterType::DENSITY))
+    , initial_stiffness(P.get_initial_stiffness())
+    , initial_history(H)
+    , current_strain(repmat(P.get_strain(), 1, N))
+    , current_stress(repmat(P.get_stress(), 1, N))
+    , current_stiffness(repmat(vectorise(P.get_stiffness()), 1, N))
+    , current_history(repmat(H, 1, N))
+    , trial_strain(current_strain)
+    , trial_stress(current_stress)
+    , trial_stiffness(current_stiffness)
+    , trial_history(current_history) {}
+
+MaterialBatch::~MaterialBatch() = default;
+
+double MaterialBatch::get_parameter(const ParameterType& T) const { return T == ParameterType::DENSITY ? density : 0.; }
+
+unsigned MaterialBatch::get_size() const { return n_point; }
+
+const mat& MaterialBatch::get_strain() const { return trial_strain; }
+
+const mat& MaterialBatch::get_stress() const { return trial_stress; }
+
+const mat& MaterialBatch::get_stiffness() const { return trial_stiffness; }
+
+const mat& MaterialBatch::get_initial_stiffness() const { return initial_stiffness; }
+
+int MaterialBatch::clear_status() {
+    current_strain.zeros();
+    current_stress.zeros();
+    current_stiffness = repmat(vectorise(initial_stiffness), 1, n_point);
+    current_history = repmat(initial_history, 1, n_point);
+    return reset_status();
+}
+
+int MaterialBatch::commit_status() {
+    current_strain = trial_strain;
+    current_stress = trial_stress;
+    current_stiffness = trial_stiffness;
+    current_history = trial_history;
+    return 0;
+}
+
+int MaterialBatch::reset_status() {
+    trial_strain = current_strain;
+    trial_stress = current_stress;
+    trial_stiffness = current_stiffness;
+    trial_history = current_history;
+    return 0;
+}
+
+void MaterialBatch::save_status(vector<vec>& D) const {
+    D.emplace_back(vectorise(current_strain));
+    D.emplace_back(vectorise(current_stress));
+    D.emplace_back(vectorise(current_stiffness));
+    D.emplace_back(vectorise(current_history));
+}
+
+void MaterialBatch::load_status(vector<vec>::const_iterator& D) {
+    current_strain = reshape(*D++, size(current_strain));
+    current_stress = reshape(*D++, size(current_stress));
+    current_stiffness = reshape(*D++, size(current_stiffness));
+    current_history = reshape(*D++, size(current_history));
+    reset_status();
+}
+
+void PointBatch::gather_trial_status() {
+    for(unsigned I = 0; I < n_point; ++I) {
+        trial_strain.col(I) = point[I]->get_strain();
+        trial_stress.col(I) = point[I]->get_stress();
+        trial_stiffness.col(I) = vectorise(point[I]->get_stiffness());
+    }
+}
+
+PointBatch::PointBatch(const unsigned N, Material& P)
+    : MaterialBatch(N, P) {
+    point.reserve(N);
+    for(unsigned I = 0; I < N; ++I) point.emplace_back(P.get_copy());
+}
+
+PointBatch::PointBatch(const PointBatch& old_obj)
+    : MaterialBatch(old_obj) {
+    point.reserve(n_point);
+    for(const auto& I : old_obj.point) point.emplace_back(I->get_copy());
+}
+
+unique_ptr<MaterialBatch> PointBatch::get_copy() { return make_unique<PointBatch>(*this); }
+
+double PointBatch::get_parameter(const ParameterType& T) const { return point.front()->get_parameter(T); }
+
+int PointBatch::update_trial_status(const mat& t_strain) {
+    auto code = 0;
+    for(unsigned I = 0; I < n_point; ++I) code += point[I]->update_trial_status(t_strain.col(I));
+    gather_trial_status();
+    return code;
+}
+
+int PointBatch::clear_status() {
+    auto code = 0;
+    for(const auto& I : point) code += I->clear_status();
+    gather_trial_status();
+    return code;
+}
+
+int PointBatch::commit_status() {
+    auto code = 0;
+    for(const auto& I : point) code += I->commit_status();
+    return code;
+}
+
+int PointBatch::reset_status() {
+    auto code = 0;
+    for(const auto& I : point) code += I->reset_status();
+    gather_trial_status();
+    return code;
+}
+
+void PointBatch::save_status(vector<vec>& D) const {
+    for(const auto& I : point) I->save_status(D);
+}
+
+void PointBatch::load_status(vector<vec>::const_iterator& D) {
+    for(const auto& I : point) I->load_status(D);
+    gather_trial_status();
+}
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (C) 2017 Theodore Chang
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+/**
+ * @class MaterialBatch
+ * @brief A MaterialBatch class stores all integration points of one material.
+ *
+ * Points sharing the same material definition are stored as structure of
+ * arrays. Each column of the strain, stress, stiffness and history matrices
+ * belongs to one point, the stiffness is stored in its vectorised form. A
+ * single call of update_trial_status() updates the whole batch.
+ *
+ * Materials that support batched update override Material::get_batch(). The
+ * default PointBatch keeps one Material object per point as a fallback.
+ *
+ * @author T
+ * @date 27/11/2017
+ * @version 0.1.0
+ * @file MaterialBatch.h
+ * @addtogroup Material
+ * @{
+ */
+
+#ifndef MATERIALBATCH_H
+#define MATERIALBATCH_H
+
+#include <Material/Material.h>
+
+class MaterialBatch {
+protected:
+    const unsigned n_point; /**< number of points */
+
+    const double density; /**< density */
+
+    const mat initial_stiffness; /**< initial stiffness shared by all points */
+    const vec initial_history;   /**< initial history shared by all points */
+
+    mat current_strain;    /**< current status */
+    mat current_stress;    /**< current status */
+    mat current_stiffness; /**< current status */
+    mat current_history;   /**< current status */
+
+    mat trial_strain;    /**< trial status */
+    mat trial_stress;    /**< trial status */
+    mat trial_stiffness; /**< trial status */
+    mat trial_history;   /**< trial status */
+public:
+    MaterialBatch(const unsigned,  // number of points
+        const Material&,           // initialized material prototype
+        const vec& = vec());       // initial history
+    MaterialBatch(const MaterialBatch&) = default;
+    virtual ~MaterialBatch();
+
+    virtual unique_ptr<MaterialBatch> get_copy() = 0;
+
+    virtual double get_parameter(const ParameterType& = ParameterType::DENSITY) const;
+
+    unsigned get_size() const;
+
+    const mat& get_strain() const;
+    const mat& get_stress() const;
+    const mat& get_stiffness() const;
+    const mat& get_initial_stiffness() const;
+
+    virtual int update_trial_status(const mat&) = 0;
+
+    virtual int clear_status();
+    virtual int commit_status();
+    virtual int reset_status();
+
+    virtual void save_status(vector<vec>&) const;
+    virtual void load_status(vector<vec>::const_iterator&);
+};
+
+class PointBatch final : public MaterialBatch {
+    vector<unique_ptr<Material>> point;
+
+    void gather_trial_status();
+public:
+    PointBatch(const unsigned, Material&);
+    PointBatch(const PointBatch&);
+
+    unique_ptr<MaterialBatch> get_copy() override;
+
+    double get_parameter(const ParameterType& = ParameterType::DENSITY) const override;
+
+    int update_trial_status(const mat&) override;
+
+    int clear_status() override;
+    int commit_status() override;
+    int reset_status() override;
+
+    void save_status(vector<vec>&) const override;
+    void load_status(vector<vec>::const_iterator&) override;
+};
+
+#endif
+
+//! @}
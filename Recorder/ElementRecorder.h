@@ -31,9 +31,14 @@
 
 #include <Recorder/Recorder.h>
 
+class Element;
+
 class ElementRecorder : public Recorder {
+    vector<shared_ptr<Element>> object_pool; /**< objects resolved at initialization */
 public:
-    explicit ElementRecorder(const unsigned& = 0, const unsigned& = 0, const OutputType& = OutputType::NL, const bool& = true);
+    explicit ElementRecorder(const unsigned& = 0, const uvec& = {}, const OutputType& = OutputType::NL, const bool& = true);
+
+    void initialize(const shared_ptr<DomainBase>&) override;
 
     void record(const shared_ptr<DomainBase>&) override;
 
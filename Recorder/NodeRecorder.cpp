@@ -20,18 +20,34 @@
 #include <Domain/Factory.hpp>
 #include <Domain/Node.h>
 
-NodeRecorder::NodeRecorder(const unsigned& T, const unsigned& B, const OutputType& L, const bool& R)
+NodeRecorder::NodeRecorder(const unsigned& T, const uvec& B, const OutputType& L, const bool& R)
     : Recorder(T, CT_NODERECORDER, B, L, R) {}
 
-void NodeRecorder::record(const shared_ptr<DomainBase>& D) {
-    auto& t_obj = D->get_node(get_object_tag());
+void NodeRecorder::initialize(const shared_ptr<DomainBase>& D) {
+    Recorder::initialize(D);
+
+    object_pool.clear();
+    object_pool.reserve(get_object_tag().n_elem);
+    vector<uword> t_tag;
+    for(const auto& I : get_object_tag())
+        if(D->find_node(unsigned(I))) {
+            object_pool.emplace_back(D->get_node(unsigned(I)));
+            t_tag.emplace_back(I);
+        } else
+            suanpan_warning("initialize() cannot find Node %u, it is not recorded.\n", unsigned(I));
+    set_record_tag(uvec(t_tag));
 
-    if(t_obj == nullptr) {
-        D->disable_recorder(get_tag());
-        return;
+    if(object_pool.empty()) D->disable_recorder(get_tag());
+}
+
+void NodeRecorder::record(const shared_ptr<DomainBase>& D) {
+    vector<vec> t_data;
+    for(const auto& I : object_pool) {
+        auto t_record = I->record(get_variable_type());
+        for(auto& J : t_record) t_data.emplace_back(std::move(J));
     }
 
-    insert(t_obj->record(get_variable_type()));
+    insert(t_data);
 
     if(if_record_time()) insert(D->get_factory()->get_current_time());
 }
@@ -31,9 +31,14 @@
 
 #include <Recorder/Recorder.h>
 
+class Node;
+
 class NodeRecorder : public Recorder {
+    vector<shared_ptr<Node>> object_pool; /**< objects resolved at initialization */
 public:
-    explicit NodeRecorder(const unsigned& = 0, const unsigned& = 0, const OutputType& = OutputType::NL, const bool& = true);
+    explicit NodeRecorder(const unsigned& = 0, const uvec& = {}, const OutputType& = OutputType::NL, const bool& = true);
+
+    void initialize(const shared_ptr<DomainBase>&) override;
 
     void record(const shared_ptr<DomainBase>&) override;
 
@@ -86,6 +86,8 @@ const char* to_char(const OutputType& L) {
         return "PE13";
     case OutputType::PEEQ:
         return "PEEQ";
+    case OutputType::ITER:
+        return "ITER";
 
     case OutputType::U:
         return "U";
@@ -203,6 +205,7 @@ OutputType to_list(const char* L) {
     if(is_equal(L, "PE23")) return OutputType::PE23;
     if(is_equal(L, "PE13")) return OutputType::PE13;
     if(is_equal(L, "PEEQ")) return OutputType::PEEQ;
+    if(is_equal(L, "ITER")) return OutputType::ITER;
 
     if(is_equal(L, "U")) return OutputType::U;
     if(is_equal(L, "UT")) return OutputType::UT;
@@ -52,6 +52,7 @@ enum class OutputType {
     PE23,
     PE13,
     PEEQ,
+    ITER,
 
     U,
     UT,
@@ -16,12 +16,14 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Recorder.h"
+#include <Domain/DomainBase.h>
+#include <Toolbox/utility.h>
 #ifndef SUANPAN_NO_HDF5
 #include <hdf5.h>
 #include <hdf5_hl.h>
 #endif
 
-Recorder::Recorder(const unsigned& T, const unsigned& CT, const unsigned& B, const OutputType& L, const bool& R)
+Recorder::Recorder(const unsigned& T, const unsigned& CT, const uvec& B, const OutputType& L, const bool& R)
     : Tag(T, CT)
     , object_tag(B)
     , variable_type(L)
@@ -29,11 +31,23 @@ Recorder::Recorder(const unsigned& T, const unsigned& CT, const unsigned& B, con
     suanpan_debug("NodeRecorder %u ctor() called.\n", T);
 }
 
-Recorder::~Recorder() { suanpan_debug("NodeRecorder %u dtor() called.\n", get_tag()); }
+Recorder::~Recorder() {
+    flush();
+#ifndef SUANPAN_NO_HDF5
+    std::lock_guard<std::mutex> t_guard(get_hdf5_mutex());
+    if(dataset_id >= 0) H5Dclose(dataset_id);
+    if(file_id >= 0) H5Fclose(file_id);
+#endif
+    suanpan_debug("NodeRecorder %u dtor() called.\n", get_tag());
+}
+
+void Recorder::set_object_tag(const uvec& T) { object_tag = T; }
+
+const uvec& Recorder::get_object_tag() const { return object_tag; }
 
-void Recorder::set_object_tag(const unsigned& T) { object_tag = T; }
+void Recorder::set_record_tag(const uvec& T) { record_tag = T; }
 
-const unsigned& Recorder::get_object_tag() const { return object_tag; }
+const uvec& Recorder::get_record_tag() const { return record_tag; }
 
 void Recorder::set_variable_type(const OutputType& T) { variable_type = T; }
 
@@ -41,30 +55,212 @@ const OutputType& Recorder::get_variable_type() const { return variable_type; }
 
 const bool& Recorder::if_record_time() const { return record_time; }
 
-void Recorder::insert(const double& T) { time_pool.push_back(T); }
+void Recorder::set_stream(const unsigned& C, const unsigned& L) {
+#ifdef SUANPAN_NO_HDF5
+    suanpan_warning("set_stream() requires HDF5 support, records are kept in memory.\n");
+#else
+    chunk_size = C;
+    compression = std::min(L, 9u);
+#endif
+}
+
+bool Recorder::is_stream() const { return chunk_size != 0; }
+
+void Recorder::set_batch_size(const unsigned& B) {
+    batch_size = std::max(1u, B);
+    n_batched = 0;
+    batch_buffer.clear();
+}
+
+const unsigned& Recorder::get_batch_size() const { return batch_size; }
+
+void Recorder::initialize(const shared_ptr<DomainBase>& D) {
+    file_prefix = D->get_tag() == 1 ? "" : "D" + std::to_string(D->get_tag()) + "_";
+
+    // derived recorders narrow it down to objects that exist
+    record_tag = object_tag;
+
+#ifndef SUANPAN_NO_HDF5
+    if(!is_stream() || file_id >= 0) return;
+
+    const auto file_name = get_file_name();
+
+    std::lock_guard<std::mutex> t_guard(get_hdf5_mutex());
+    file_id = H5Fcreate(file_name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
 
-void Recorder::insert(const vector<vec>& D) { data_pool.push_back(D); }
+    if(file_id < 0) {
+        suanpan_error("initialize() cannot create file %s, records are kept in memory.\n", file_name.c_str());
+        chunk_size = 0;
+    }
+#endif
+}
 
-const vector<vector<vec>>& Recorder::get_data_pool() const { return data_pool; }
+void Recorder::insert(const double& T) {
+    // the time is inserted once all cases of the record arrive
+    if(n_batched != 0) return;
+
+    if(!is_stream()) time_pool.push_back(T);
+    else if(time_pending) {
+        stream_buffer(0, n_buffered - 1) = T;
+        time_pending = false;
+    }
+}
+
+void Recorder::insert(const vector<vec>& D) {
+    if(batch_size > 1) {
+        batch_buffer.insert(batch_buffer.end(), D.cbegin(), D.cend());
+        if(++n_batched < batch_size) return;
+        n_batched = 0;
+        append(batch_buffer);
+        batch_buffer.clear();
+        return;
+    }
+
+    append(D);
+}
+
+void Recorder::append(const vector<vec>& D) {
+    uword t_size = 0;
+    for(const auto& I : D) t_size += I.n_elem;
+
+    double* t_column;
+
+    if(is_stream()) {
+        // the time of the last record arrives after its data, flush before a new record
+        if(n_buffered == chunk_size) flush();
+
+        if(stream_buffer.is_empty()) stream_buffer.zeros(t_size + 1, chunk_size);
+
+        // the width of streamed dataset is fixed by the first record
+        if(t_size + 1 != stream_buffer.n_rows) {
+            suanpan_error("append() receives a record of size %u but Recorder %u streams records of size %u, it is discarded.\n", unsigned(t_size), get_tag(), unsigned(stream_buffer.n_rows - 1));
+            return;
+        }
+
+        stream_buffer.col(n_buffered).zeros();
+        t_column = stream_buffer.colptr(n_buffered++) + 1;
+        time_pending = true;
+    } else {
+        data_pool.emplace_back(t_size);
+        t_column = data_pool.back().memptr();
+    }
+
+    for(const auto& I : D) {
+        arrayops::copy(t_column, I.memptr(), I.n_elem);
+        t_column += I.n_elem;
+    }
+}
+
+const vector<vec>& Recorder::get_data_pool() const { return data_pool; }
 
 const vector<double>& Recorder::get_time_pool() const { return time_pool; }
 
+string Recorder::get_file_name() const {
+    ostringstream file_name;
+
+    // single object recorders keep the original naming
+    file_name << file_prefix << to_char(variable_type);
+    if(object_tag.n_elem == 1)
+        file_name << object_tag(0);
+    else
+        file_name << "R" << get_tag();
+    file_name << ".h5";
+
+    return file_name.str();
+}
+
+#ifndef SUANPAN_NO_HDF5
+void Recorder::create_dataset(const hsize_t& width) {
+    string group_name = "/";
+    group_name += to_char(variable_type);
+
+    const auto data_name = get_file_name();
+
+    hsize_t dimension[2] = { 1, width };
+    hsize_t max_dimension[2] = { H5S_UNLIMITED, width };
+    hsize_t chunk_dimension[2] = { chunk_size, width };
+
+    const auto space_id = H5Screate_simple(2, dimension, max_dimension);
+    const auto property_id = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(property_id, 2, chunk_dimension);
+    if(compression != 0) H5Pset_deflate(property_id, compression);
+
+    const auto group_id = H5Gcreate(file_id, group_name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    dataset_id = H5Dcreate(group_id, data_name.c_str(), H5T_NATIVE_DOUBLE, space_id, H5P_DEFAULT, property_id, H5P_DEFAULT);
+
+    const Col<unsigned> t_tag = conv_to<Col<unsigned>>::from(record_tag);
+    hsize_t tag_dimension[1] = { t_tag.n_elem };
+    H5LTmake_dataset(group_id, "tag", 1, tag_dimension, H5T_NATIVE_UINT, t_tag.memptr());
+
+    // the first row is the initial state, same as save()
+    const vec t_zero(width, fill::zeros);
+    H5Dwrite(dataset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, t_zero.memptr());
+
+    H5Pclose(property_id);
+    H5Sclose(space_id);
+    H5Gclose(group_id);
+}
+#endif
+
+void Recorder::flush() {
+#ifndef SUANPAN_NO_HDF5
+    if(n_buffered == 0 || file_id < 0) return;
+
+    std::lock_guard<std::mutex> t_guard(get_hdf5_mutex());
+
+    if(dataset_id < 0) create_dataset(stream_buffer.n_rows);
+
+    hsize_t dimension[2];
+    const auto old_space_id = H5Dget_space(dataset_id);
+    H5Sget_simple_extent_dims(old_space_id, dimension, nullptr);
+    H5Sclose(old_space_id);
+
+    hsize_t offset[2] = { dimension[0], 0 };
+    hsize_t count[2] = { n_buffered, stream_buffer.n_rows };
+
+    dimension[0] += n_buffered;
+    H5Dset_extent(dataset_id, dimension);
+
+    // each column of buffer is a row in file
+    const auto file_space_id = H5Dget_space(dataset_id);
+    H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET, offset, nullptr, count, nullptr);
+    const auto memory_space_id = H5Screate_simple(2, count, nullptr);
+
+    H5Dwrite(dataset_id, H5T_NATIVE_DOUBLE, memory_space_id, file_space_id, H5P_DEFAULT, stream_buffer.memptr());
+
+    H5Sclose(memory_space_id);
+    H5Sclose(file_space_id);
+
+    H5Fflush(file_id, H5F_SCOPE_LOCAL);
+
+    n_buffered = 0;
+    time_pending = false;
+#endif
+}
+
 void Recorder::save() {
 #ifndef SUANPAN_NO_HDF5
+    if(is_stream()) {
+        flush();
+        return;
+    }
+
     if(time_pool.empty()) return;
 
-    ostringstream file_name;
+    const auto file_name = get_file_name();
 
-    file_name << to_char(variable_type) << object_tag << ".h5";
+    // batched records may be wider than previous ones, shorter columns are padded with zeros
+    uword t_size = 0;
+    for(const auto& I : data_pool) t_size = std::max(t_size, I.n_elem);
 
-    mat data_to_write(data_pool.cbegin()->size() * data_pool.cbegin()->cbegin()->n_elem + 1, time_pool.size() + 1);
-    data_to_write.col(0).zeros();
+    // nothing but time is recorded, for example none of the recorded objects exists
+    if(t_size == 0) return;
+
+    mat data_to_write(t_size + 1, time_pool.size() + 1, fill::zeros);
 
     for(size_t I = 0; I < time_pool.size(); ++I) {
         data_to_write(0, I + 1) = time_pool[I];
-        auto idx = 1;
-        for(const auto& J : data_pool[I])
-            for(unsigned K = 0; K < J.n_elem; ++K) data_to_write(idx++, I + 1) = J[K];
+        if(!data_pool[I].is_empty()) data_to_write.col(I + 1).subvec(1, data_pool[I].n_elem) = data_pool[I];
     }
 
     hsize_t dimention[2] = { data_to_write.n_cols, data_to_write.n_rows };
@@ -72,13 +268,19 @@ void Recorder::save() {
     string group_name = "/";
     group_name += to_char(get_variable_type());
 
-    const auto file_id = H5Fcreate(file_name.str().c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
-    const auto group_id = H5Gcreate(file_id, group_name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    const Col<unsigned> t_tag = conv_to<Col<unsigned>>::from(record_tag);
+    hsize_t tag_dimension[1] = { t_tag.n_elem };
+
+    std::lock_guard<std::mutex> t_guard(get_hdf5_mutex());
+
+    const auto t_file_id = H5Fcreate(file_name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    const auto group_id = H5Gcreate(t_file_id, group_name.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
 
-    H5LTmake_dataset(group_id, file_name.str().c_str(), 2, dimention, H5T_NATIVE_DOUBLE, data_to_write.mem);
+    H5LTmake_dataset(group_id, file_name.c_str(), 2, dimention, H5T_NATIVE_DOUBLE, data_to_write.mem);
+    H5LTmake_dataset(group_id, "tag", 1, tag_dimension, H5T_NATIVE_UINT, t_tag.memptr());
 
     H5Gclose(group_id);
-    H5Fclose(file_id);
+    H5Fclose(t_file_id);
 #endif
 }
 
@@ -17,6 +17,20 @@
 /**
  * @class Recorder
  * @brief A Recorder class.
+ *
+ * By default all records are kept in memory and written by `save()`. In
+ * streaming mode, records are buffered in chunks and appended to an
+ * extendible HDF5 dataset, so memory usage is bounded by the chunk size and
+ * data written before an abort remain readable.
+ *
+ * A recorder may track a set of objects, records of all objects in one step
+ * are gathered into one contiguous column and written to a single file.
+ *
+ * In batched analysis, records of all cases in one step are gathered in the
+ * same way, the block of each case follows the previous one in the column.
+ *
+ * Files of recorders in domains other than the default one are prefixed by
+ * the domain tag, so that ensemble members do not overwrite each other.
  * @author T
  * @date 27/07/2017
  * @version 0.1.0
@@ -29,37 +43,76 @@
 
 #include <Domain/Tag.h>
 #include <Recorder/OutputType.h>
+#ifndef SUANPAN_NO_HDF5
+#include <hdf5.h>
+#endif
 
 class DomainBase;
 
 using std::vector;
 
 class Recorder : public Tag {
-    unsigned object_tag;
+    uvec object_tag;
+    uvec record_tag; /**< tags of objects actually recorded */
     OutputType variable_type;
-    vector<double> time_pool;      /**< recorded data */
-    vector<vector<vec>> data_pool; /**< recorded data */
+    vector<double> time_pool; /**< recorded data */
+    vector<vec> data_pool;    /**< recorded data */
 
     bool record_time;
 
+    unsigned chunk_size = 0;   /**< number of records per chunk, zero to keep all in memory */
+    unsigned compression = 0;  /**< deflate level of streamed dataset */
+    unsigned n_buffered = 0;   /**< number of records in buffer */
+    bool time_pending = false; /**< the last buffered record waits for its time */
+    mat stream_buffer;         /**< buffer of streamed records */
+
+    unsigned batch_size = 1;  /**< number of cases per record */
+    unsigned n_batched = 0;   /**< number of cases in buffer */
+    vector<vec> batch_buffer; /**< buffer of batched cases */
+
+#ifndef SUANPAN_NO_HDF5
+    hid_t file_id = -1;
+    hid_t dataset_id = -1;
+
+    void create_dataset(const hsize_t&);
+#endif
+
+    void append(const vector<vec>&);
+    void flush();
+
+    string file_prefix; /**< prefix of file name */
+
+    string get_file_name() const;
+
 public:
-    explicit Recorder(const unsigned& = 0, const unsigned& = CT_RECORDER, const unsigned& = 0, const OutputType& = OutputType::NL, const bool& = true);
+    explicit Recorder(const unsigned& = 0, const unsigned& = CT_RECORDER, const uvec& = {}, const OutputType& = OutputType::NL, const bool& = true);
     Recorder(const Recorder&) = delete;
     Recorder& operator=(const Recorder&) = delete;
     virtual ~Recorder();
 
-    void set_object_tag(const unsigned&);
-    const unsigned& get_object_tag() const;
+    void set_object_tag(const uvec&);
+    const uvec& get_object_tag() const;
+
+    void set_record_tag(const uvec&);
+    const uvec& get_record_tag() const;
 
     void set_variable_type(const OutputType&);
     const OutputType& get_variable_type() const;
 
     const bool& if_record_time() const;
 
+    void set_stream(const unsigned&, const unsigned& = 0);
+    bool is_stream() const;
+
+    void set_batch_size(const unsigned&);
+    const unsigned& get_batch_size() const;
+
+    virtual void initialize(const shared_ptr<DomainBase>&);
+
     void insert(const double&);
     void insert(const vector<vec>&);
 
-    const vector<vector<vec>>& get_data_pool() const;
+    const vector<vec>& get_data_pool() const;
     const vector<double>& get_time_pool() const;
 
     virtual void record(const shared_ptr<DomainBase>&) = 0;
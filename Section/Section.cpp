@@ -78,6 +78,20 @@ int Section::commit_status() { throw invalid_argument("hidden method called.\n")
 
 int Section::reset_status() { throw invalid_argument("hidden method called.\n"); }
 
+void Section::save_status(vector<vec>& D) const {
+    D.emplace_back(current_deformation);
+    D.emplace_back(current_deformation_rate);
+    D.emplace_back(current_resistance);
+    D.emplace_back(vectorise(current_stiffness));
+}
+
+void Section::load_status(vector<vec>::const_iterator& D) {
+    current_deformation = *D++;
+    current_deformation_rate = *D++;
+    current_resistance = *D++;
+    current_stiffness = reshape(*D++, size(current_stiffness));
+}
+
 unique_ptr<Section> suanpan::make_copy(const shared_ptr<Section>& S) { return S->get_copy(); }
 
 unique_ptr<Section> suanpan::make_copy(const unique_ptr<Section>& S) { return S->get_copy(); }
@@ -85,6 +85,9 @@ public:
     virtual int clear_status() = 0;
     virtual int commit_status() = 0;
     virtual int reset_status() = 0;
+
+    virtual void save_status(vector<vec>&) const;
+    virtual void load_status(vector<vec>::const_iterator&);
 };
 
 namespace suanpan {
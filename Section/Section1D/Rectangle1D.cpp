@@ -103,4 +103,14 @@ int Rectangle1D::reset_status() {
     return s_material->reset_status();
 }
 
+void Rectangle1D::save_status(vector<vec>& D) const {
+    Section::save_status(D);
+    s_material->save_status(D);
+}
+
+void Rectangle1D::load_status(vector<vec>::const_iterator& D) {
+    Section::load_status(D);
+    s_material->load_status(D);
+}
+
 void Rectangle1D::print() { suanpan_info("A Rectangle1D Section.\n"); }
@@ -16,17 +16,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "HSection2D.h"
-#include <Material/Material1D/Material1D.h>
-
-HSection2D::IntegrationPoint::IntegrationPoint(const double C, const double W, unique_ptr<Material>&& M)
-    : coor(C)
-    , weight(W)
-    , s_material(move(M)) {}
-
-HSection2D::IntegrationPoint::IntegrationPoint(const IntegrationPoint& old_obj)
-    : coor(old_obj.coor)
-    , weight(old_obj.weight)
-    , s_material(old_obj.s_material->get_copy()) {}
+#include <Toolbox/IntegrationPlan.h>
 
 HSection2D::HSection2D(const unsigned T, const double TFW, const double TFT, const double BFW, const double BFT, const double WH, const double WT, const unsigned MT, const unsigned IP)
     : Section2D(T, ST_HSECTION2D, MT)
@@ -38,18 +28,33 @@ HSection2D::HSection2D(const unsigned T, const double TFW, const double TFT, con
     , web_thickness(WT)
     , int_pt_num(IP) {}
 
-void HSection2D::initialize(const shared_ptr<DomainBase>&) { area = left_flange_height * left_flange_thickness + right_flange_height * right_flange_thickness + web_width * web_thickness; }
+void HSection2D::initialize(const shared_ptr<DomainBase>& D) {
+    area = left_flange_height * left_flange_thickness + right_flange_height * right_flange_thickness + web_width * web_thickness;
+
+    const IntegrationPlan plan_flange(1, int_pt_num, IntegrationType::GAUSS);
+    const IntegrationPlan plan_web(1, 2, IntegrationType::GAUSS);
+
+    // both flanges and the web are symmetric about the bending axis
+    int_pt_coor.set_size(2 * int_pt_num + 2);
+    int_pt_weight.set_size(2 * int_pt_num + 2);
+
+    unsigned J = 0;
+    for(unsigned I = 0; I < int_pt_num; ++I, ++J) {
+        int_pt_coor(J) = .5 * left_flange_height * plan_flange(I, 0);
+        int_pt_weight(J) = .5 * left_flange_height * left_flange_thickness * plan_flange(I, 1);
+    }
+    for(unsigned I = 0; I < 2; ++I, ++J) {
+        int_pt_coor(J) = .5 * web_thickness * plan_web(I, 0);
+        int_pt_weight(J) = .5 * web_thickness * web_width * plan_web(I, 1);
+    }
+    for(unsigned I = 0; I < int_pt_num; ++I, ++J) {
+        int_pt_coor(J) = .5 * right_flange_height * plan_flange(I, 0);
+        int_pt_weight(J) = .5 * right_flange_height * right_flange_thickness * plan_flange(I, 1);
+    }
+
+    initialize_fibre(D);
+}
 
 unique_ptr<Section> HSection2D::get_copy() { return make_unique<HSection2D>(*this); }
 
-double HSection2D::get_parameter(const ParameterType&) { return 0.; }
-
-int HSection2D::update_trial_status(const vec&) { return 0; }
-
-int HSection2D::clear_status() { return 0; }
-
-int HSection2D::commit_status() { return 0; }
-
-int HSection2D::reset_status() { return 0; }
-
-void HSection2D::print() {}
+void HSection2D::print() { suanpan_info("An HSection2D Section.\n"); }
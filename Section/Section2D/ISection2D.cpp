@@ -16,21 +16,10 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "ISection2D.h"
-#include "Toolbox/IntegrationPlan.h"
-#include <Material/Material1D/Material1D.h>
-
-ISection2D::IntegrationPoint::IntegrationPoint(const double C, const double W, unique_ptr<Material>&& M)
-    : coor(C)
-    , weight(W)
-    , s_material(move(M)) {}
-
-ISection2D::IntegrationPoint::IntegrationPoint(const IntegrationPoint& old_obj)
-    : coor(old_obj.coor)
-    , weight(old_obj.weight)
-    , s_material(old_obj.s_material->get_copy()) {}
+#include <Toolbox/IntegrationPlan.h>
 
 ISection2D::ISection2D(const unsigned T, const double TFW, const double TFT, const double BFW, const double BFT, const double WH, const double WT, const unsigned MT, const unsigned IP)
-    : Section2D(T, ST_HSECTION2D, MT)
+    : Section2D(T, ST_ISECTION2D, MT)
     , top_flange_width(TFW)
     , top_flange_thickness(TFT)
     , bottom_flange_width(BFW)
@@ -42,24 +31,35 @@ ISection2D::ISection2D(const unsigned T, const double TFW, const double TFT, con
 
 void ISection2D::initialize(const shared_ptr<DomainBase>& D) {
     area = top_flange_width * top_flange_thickness + bottom_flange_width * bottom_flange_thickness + web_height * web_thickness;
-    const IntegrationPlan plan_flange(1, 2, IntegrationType::RADAU);
-    const IntegrationPlan plan_web(1, 6, IntegrationType::GAUSS);
-}
-
-unique_ptr<Section> ISection2D::get_copy() { return make_unique<ISection2D>(*this); }
 
-double ISection2D::get_parameter(const ParameterType& P) {
-    if(P == ParameterType::AREA) return area;
+    const IntegrationPlan plan_flange(1, 2, IntegrationType::GAUSS);
+    const IntegrationPlan plan_web(1, int_pt_num, IntegrationType::GAUSS);
 
-    return 0.;
-}
+    // the coordinate is measured from the mid-height of the section
+    const auto top_centre = .5 * (height - top_flange_thickness);
+    const auto web_centre = .5 * (bottom_flange_thickness - top_flange_thickness);
+    const auto bottom_centre = .5 * (bottom_flange_thickness - height);
 
-int ISection2D::update_trial_status(const vec&) { return 0; }
+    int_pt_coor.set_size(int_pt_num + 4);
+    int_pt_weight.set_size(int_pt_num + 4);
 
-int ISection2D::clear_status() { return 0; }
+    unsigned J = 0;
+    for(unsigned I = 0; I < 2; ++I, ++J) {
+        int_pt_coor(J) = top_centre + .5 * top_flange_thickness * plan_flange(I, 0);
+        int_pt_weight(J) = .5 * top_flange_width * top_flange_thickness * plan_flange(I, 1);
+    }
+    for(unsigned I = 0; I < int_pt_num; ++I, ++J) {
+        int_pt_coor(J) = web_centre + .5 * web_height * plan_web(I, 0);
+        int_pt_weight(J) = .5 * web_thickness * web_height * plan_web(I, 1);
+    }
+    for(unsigned I = 0; I < 2; ++I, ++J) {
+        int_pt_coor(J) = bottom_centre + .5 * bottom_flange_thickness * plan_flange(I, 0);
+        int_pt_weight(J) = .5 * bottom_flange_width * bottom_flange_thickness * plan_flange(I, 1);
+    }
 
-int ISection2D::commit_status() { return 0; }
+    initialize_fibre(D);
+}
 
-int ISection2D::reset_status() { return 0; }
+unique_ptr<Section> ISection2D::get_copy() { return make_unique<ISection2D>(*this); }
 
-void ISection2D::print() {}
+void ISection2D::print() { suanpan_info("An ISection2D Section.\n"); }
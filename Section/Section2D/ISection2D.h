@@ -40,15 +40,6 @@ class ISection2D : public Section2D {
 
     const unsigned int_pt_num;
 
-    struct IntegrationPoint {
-        double coor, weight;
-        unique_ptr<Material> s_material;
-        IntegrationPoint(const double, const double, unique_ptr<Material>&&);
-        IntegrationPoint(const IntegrationPoint&);
-    };
-
-    vector<IntegrationPoint> int_pt;
-
 public:
     explicit ISection2D(const unsigned, // tag
         const double,                   // width
@@ -65,14 +56,6 @@ public:
 
     unique_ptr<Section> get_copy() override;
 
-    double get_parameter(const ParameterType&) override;
-
-    int update_trial_status(const vec&) override;
-
-    int clear_status() override;
-    int commit_status() override;
-    int reset_status() override;
-
     void print() override;
 };
 
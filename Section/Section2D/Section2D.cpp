@@ -16,6 +16,143 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Section2D.h"
+#include <Domain/DomainBase.h>
+#include <Material/Material.h>
+#ifdef __AVX__
+#include <immintrin.h>
+#endif
 
 Section2D::Section2D(const unsigned T, const unsigned CT, const unsigned MT)
     : Section(T, CT, SectionType::D2, MT) {}
+
+Section2D::Section2D(const Section2D& old_obj)
+    : Section(old_obj)
+    , int_pt_coor(old_obj.int_pt_coor)
+    , int_pt_weight(old_obj.int_pt_weight)
+    , s_material(old_obj.s_material == nullptr ? nullptr : old_obj.s_material->get_copy()) {}
+
+// axial and flexural stiffness, axial force and moment are accumulated in one pass over all fibres
+void Section2D::integrate_fibre() {
+    const auto n_fibre = int_pt_coor.n_elem;
+
+    const auto coor = int_pt_coor.memptr();
+    const auto weight = int_pt_weight.memptr();
+    const auto stiffness = s_material->get_stiffness().memptr();
+    const auto stress = s_material->get_stress().memptr();
+
+    const auto ecc = eccentricity(0);
+
+    auto axial_stiffness = 0., flexural_stiffness = 0., axial_force = 0., moment = 0.;
+
+    uword I = 0;
+#ifdef __AVX__
+    auto sum_a = _mm256_setzero_pd(), sum_b = _mm256_setzero_pd(), sum_c = _mm256_setzero_pd(), sum_d = _mm256_setzero_pd();
+    const auto t_ecc = _mm256_set1_pd(ecc);
+    for(; I + 4 <= n_fibre; I += 4) {
+        const auto t_weight = _mm256_loadu_pd(weight + I);
+        const auto t_arm = _mm256_sub_pd(_mm256_loadu_pd(coor + I), t_ecc);
+        const auto t_stiffness = _mm256_mul_pd(_mm256_loadu_pd(stiffness + I), t_weight);
+        const auto t_stress = _mm256_mul_pd(_mm256_loadu_pd(stress + I), t_weight);
+        sum_a = _mm256_add_pd(sum_a, t_stiffness);
+        sum_b = _mm256_add_pd(sum_b, _mm256_mul_pd(_mm256_mul_pd(t_stiffness, t_arm), t_arm));
+        sum_c = _mm256_add_pd(sum_c, t_stress);
+        sum_d = _mm256_add_pd(sum_d, _mm256_mul_pd(t_stress, t_arm));
+    }
+    double buffer[4];
+    _mm256_storeu_pd(buffer, sum_a);
+    axial_stiffness = buffer[0] + buffer[1] + buffer[2] + buffer[3];
+    _mm256_storeu_pd(buffer, sum_b);
+    flexural_stiffness = buffer[0] + buffer[1] + buffer[2] + buffer[3];
+    _mm256_storeu_pd(buffer, sum_c);
+    axial_force = buffer[0] + buffer[1] + buffer[2] + buffer[3];
+    _mm256_storeu_pd(buffer, sum_d);
+    moment = buffer[0] + buffer[1] + buffer[2] + buffer[3];
+#endif
+    for(; I < n_fibre; ++I) {
+        const auto arm = coor[I] - ecc;
+        const auto tmp_a = stiffness[I] * weight[I];
+        const auto tmp_b = stress[I] * weight[I];
+        axial_stiffness += tmp_a;
+        flexural_stiffness += tmp_a * arm * arm;
+        axial_force += tmp_b;
+        moment += tmp_b * arm;
+    }
+
+    trial_stiffness.zeros();
+    trial_stiffness(0, 0) = axial_stiffness;
+    trial_stiffness(1, 1) = flexural_stiffness;
+
+    trial_resistance(0) = axial_force;
+    trial_resistance(1) = -moment;
+}
+
+void Section2D::initialize_fibre(const shared_ptr<DomainBase>& D) {
+    s_material = D->get_material(material_tag)->get_batch(int_pt_coor.n_elem);
+
+    integrate_fibre();
+
+    initial_stiffness = trial_stiffness;
+    current_stiffness = initial_stiffness;
+}
+
+double Section2D::get_parameter(const ParameterType& P) {
+    switch(P) {
+    case ParameterType::AREA:
+        return area;
+    case ParameterType::DENSITY:
+        return s_material->get_parameter(ParameterType::DENSITY);
+    default:
+        return 0.;
+    }
+}
+
+int Section2D::update_trial_status(const vec& t_deformation) {
+    trial_deformation = t_deformation;
+
+    // all fibres are updated in one call
+    const auto code = s_material->update_trial_status(trial_deformation(0) - trial_deformation(1) * int_pt_coor);
+
+    if(code != 0) {
+        trial_stiffness.zeros();
+        trial_resistance.zeros();
+        return code;
+    }
+
+    integrate_fibre();
+
+    return 0;
+}
+
+int Section2D::clear_status() {
+    current_deformation.zeros();
+    trial_deformation.zeros();
+    current_resistance.zeros();
+    trial_resistance.zeros();
+    current_stiffness = initial_stiffness;
+    trial_stiffness = initial_stiffness;
+    return s_material->clear_status();
+}
+
+int Section2D::commit_status() {
+    current_deformation = trial_deformation;
+    current_resistance = trial_resistance;
+    current_stiffness = trial_stiffness;
+    return s_material->commit_status();
+}
+
+int Section2D::reset_status() {
+    trial_deformation = current_deformation;
+    trial_resistance = current_resistance;
+    trial_stiffness = current_stiffness;
+    return s_material->reset_status();
+}
+
+void Section2D::save_status(vector<vec>& D) const {
+    Section::save_status(D);
+    s_material->save_status(D);
+}
+
+void Section2D::load_status(vector<vec>::const_iterator& D) {
+    Section::load_status(D);
+    s_material->load_status(D);
+}
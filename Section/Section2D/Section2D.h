@@ -17,6 +17,11 @@
 /**
  * @class Section2D
  * @brief A Section2D class.
+ *
+ * The Section2D class integrates uniaxial fibres. Fibre coordinates and
+ * weights are stored in contiguous arrays, the fibre materials are updated
+ * as one MaterialBatch. Derived classes only need to define the fibre layout
+ * in initialize() and then call initialize_fibre().
  * @author T
  * @date 27/10/2017
  * @version 0.1.0
@@ -29,11 +34,34 @@
 #ifndef SECTION2D_H
 #define SECTION2D_H
 
+#include <Material/MaterialBatch.h>
 #include <Section/Section.h>
 
 class Section2D : public Section {
+    void integrate_fibre();
+
+protected:
+    rowvec int_pt_coor;   /**< fibre coordinates */
+    rowvec int_pt_weight; /**< fibre weights */
+
+    unique_ptr<MaterialBatch> s_material; /**< fibre materials */
+
+    void initialize_fibre(const shared_ptr<DomainBase>&);
+
 public:
     explicit Section2D(const unsigned T = 0, const unsigned CT = CT_SECTION, const unsigned MT = 0);
+    Section2D(const Section2D&);
+
+    double get_parameter(const ParameterType&) override;
+
+    int update_trial_status(const vec&) override;
+
+    int clear_status() override;
+    int commit_status() override;
+    int reset_status() override;
+
+    void save_status(vector<vec>&) const override;
+    void load_status(vector<vec>::const_iterator&) override;
 };
 
 #endif
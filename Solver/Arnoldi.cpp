@@ -19,31 +19,41 @@
 #include <Domain/DomainBase.h>
 #include <Domain/Factory.hpp>
 #include <Solver/Integrator/Integrator.h>
+#include <Toolbox/arpack_wrapper.h>
 
-Arnoldi::Arnoldi(const unsigned& T)
-    : Solver(T, CT_ARNOLDI) {}
+Arnoldi::Arnoldi(const unsigned& T, const unsigned& N, const double& S)
+    : Solver(T, CT_ARNOLDI)
+    , eigen_num(N)
+    , shift(S) {}
 
 int Arnoldi::analyze() {
     auto& G = get_integrator();
-    auto& W = G->get_domain().lock()->get_factory();
-
-    // assemble resistance
-    G->assemble_resistance();
-    // assemble stiffness
-    G->assemble_matrix();
-    // process loads
-    G->process_load();
+    const auto& D = G->get_domain().lock();
+    auto& W = D->get_factory();
+
+    // assemble mass
+    D->assemble_mass();
+    // assemble current stiffness
+    D->assemble_stiffness();
     // process constraints
     G->process_constraint();
 
-    auto& mass = W->get_mass();
-    auto& stiffness = W->get_stiffness();
-
-    const auto factorized_mass = mass->factorize();
+    const auto code = eig_solve(get_eigenvalue(W), get_eigenvector(W), W->get_stiffness(), W->get_mass(), eigen_num, shift);
 
-    auto success = factorized_mass.n_elem == 0;
+    if(code != 0) {
+        suanpan_error("analyze() fails to solve the eigen problem.\n");
+        return -1;
+    }
 
     return 0;
 }
 
-void Arnoldi::print() { suanpan_info("A solver using Arnoldi--Raphson iteration method.\n"); }
+void Arnoldi::set_eigen_number(const unsigned& N) { eigen_num = N; }
+
+const unsigned& Arnoldi::get_eigen_number() const { return eigen_num; }
+
+void Arnoldi::set_shift(const double& S) { shift = S; }
+
+const double& Arnoldi::get_shift() const { return shift; }
+
+void Arnoldi::print() { suanpan_info("A solver using Arnoldi iteration in shift-invert mode.\n"); }
@@ -17,9 +17,13 @@
 /**
  * @class Arnoldi
  * @brief A Arnoldi class defines a solver using Arnoldi iteration.
+ *
+ * The generalized eigenvalue problem K*x=lambda*M*x is solved by ARPACK in
+ * shift-invert mode so that eigenvalues closest to the shift converge first.
+ * Eigenvalues and eigenvectors are stored in Factory.
  * @author T
  * @date 19/10/2017
- * @version 0.1.0
+ * @version 0.2.0
  * @file Arnoldi.h
  * @addtogroup Solver
  * @{
@@ -31,11 +35,19 @@
 #include <Solver/Solver.h>
 
 class Arnoldi : public Solver {
+    unsigned eigen_num; /**< number of eigenvalues */
+    double shift;       /**< shift of spectrum */
 public:
-    explicit Arnoldi(const unsigned& = 0);
+    explicit Arnoldi(const unsigned& = 0, const unsigned& = 4, const double& = 0.);
 
     int analyze() override;
 
+    void set_eigen_number(const unsigned&);
+    const unsigned& get_eigen_number() const;
+
+    void set_shift(const double&);
+    const double& get_shift() const;
+
     void print() override;
 };
 
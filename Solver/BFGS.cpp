@@ -20,6 +20,7 @@
 #include <Domain/DomainBase.h>
 #include <Domain/Factory.hpp>
 #include <Solver/Integrator/Integrator.h>
+#include <Toolbox/Profiler.h>
 
 BFGS::BFGS(const unsigned T)
     : Solver(T, CT_BFGS) {}
@@ -43,8 +44,11 @@ int BFGS::analyze() {
     hist_residual.clear();
     hist_factor.clear();
 
+    PhaseTimer T;
+
     while(true) {
         // assemble resistance
+        T.tic(ProfilePhase::RESISTANCE);
         G->assemble_resistance();
 
         // displacement load only applies once at first iteration
@@ -56,18 +60,23 @@ int BFGS::analyze() {
 
         if(counter == 0) {
             // asemble stiffness for the first iteration
+            T.tic(ProfilePhase::STIFFNESS);
             G->assemble_matrix();
             // process loads and constraints
+            T.tic(ProfilePhase::LOAD);
             G->process_load();
+            T.tic(ProfilePhase::CONSTRAINT);
             G->process_constraint();
             // commit current residual
             hist_residual.emplace_back(W->get_trial_load() - W->get_sushi());
             // solve the system and commit current displacement increment
+            T.tic(ProfilePhase::FACTORIZATION);
             hist_ninja.emplace_back(W->get_stiffness()->solve(*hist_residual.crbegin()));
             // copy current displacement increment to ninja
             ninja = *hist_ninja.crbegin(); // only for updating status
         } else {
             // clear temporary factor container
+            T.tic(ProfilePhase::SOLVE);
             alpha.clear();
             // commit current residual
             hist_residual.emplace_back(W->get_trial_load() - W->get_sushi());
@@ -94,6 +103,7 @@ int BFGS::analyze() {
         hist_factor.emplace_back(dot(*hist_ninja.crbegin(), *hist_residual.crbegin()));
 
         // avoid machine error accumulation
+        T.tic(ProfilePhase::UPDATE);
         G->erase_machine_error();
         // update trial status for factory
         W->update_trial_displacement(W->get_trial_displacement() + W->get_ninja());
@@ -101,6 +111,7 @@ int BFGS::analyze() {
         if(G->update_trial_status() != 0) return -1;
 
         // exit if converged
+        T.tic(ProfilePhase::CONVERGENCE);
         if(C->is_converged()) return 0;
         // exit if maximum iteration is hit
         if(++counter > max_iteration) return -1;
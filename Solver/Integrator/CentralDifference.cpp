@@ -18,31 +18,64 @@
 #include "CentralDifference.h"
 #include <Domain/DomainBase.h>
 #include <Domain/Factory.hpp>
-#include <future>
+#include <Element/Element.h>
+#include <Toolbox/ThreadPool.h>
 
 CentralDifference::CentralDifference(const unsigned& T)
-    : Integrator(T, CT_CENTRALDIFFERENCE) {}
+    : Integrator(T, CT_CENTRALDIFFERENCE)
+    , lumping(LumpingScheme::HRZ) {}
 
 int CentralDifference::initialize() {
     const auto code = Integrator::initialize();
 
-    if(code == 0) {
-        const auto& W = get_domain().lock()->get_factory();
+    if(code != 0) return code;
 
-        // const auto eig_val = eig_sym(W->get_mass().i() * W->get_stiffness());
+    const auto& D = get_domain().lock();
+    const auto& W = D->get_factory();
+
+    // the maximum frequency of the system is bounded by the maximum element frequency
+    auto max_omega = 0.;
+    for(const auto& I : D->get_element_pool()) {
+        const vec t_mass = I->get_lumped_mass(lumping);
+        const auto& t_stiffness = I->get_stiffness();
+        if(t_mass.is_empty() || t_stiffness.is_empty()) continue;
+        // row sum of consistent mass of elements with rotational DoFs may be negative
+        if(any(t_mass < 0.)) suanpan_warning("initialize() detects negative lumped mass in element %u, HRZ lumping is recommended.\n", I->get_tag());
+        // massless DoFs are fixed, which gives a conservative estimation
+        const uvec t_idx = find(t_mass > 0.);
+        if(t_idx.is_empty()) continue;
+        const vec t_scale = 1. / sqrt(t_mass(t_idx));
+        const mat t_matrix = t_stiffness(t_idx, t_idx) % (t_scale * t_scale.t());
+        const vec t_eigval = eig_sym(.5 * (t_matrix + t_matrix.t()));
+        if(!t_eigval.is_empty()) max_omega = std::max(max_omega, sqrt(std::max(0., t_eigval.max())));
+    }
+
+    max_dt = max_omega == 0. ? datum::inf : 2. / max_omega;
 
-        // max_dt = datum::pi / sqrt(eig_val.max());
+    DT = 0.;
+    lumped = false;
+
+    if(W->get_storage_scheme() == StorageScheme::DIAGONAL) {
+        D->assemble_lumped_mass(lumping);
+        D->assemble_lumped_damping();
+        lumped = true;
     }
 
-    return code;
+    return 0;
 }
 
+void CentralDifference::set_lumping_scheme(const LumpingScheme& S) { lumping = S; }
+
+const LumpingScheme& CentralDifference::get_lumping_scheme() const { return lumping; }
+
+const double& CentralDifference::get_critical_step_size() const { return max_dt; }
+
 void CentralDifference::update_parameter() {
     const auto& W = get_domain().lock()->get_factory();
 
     if(DT != W->get_incre_time() || W->get_pre_displacement().is_empty()) {
         DT = W->get_incre_time();
-        if(DT > max_dt) suanpan_error("update_status() requires a smaller time increment.\n");
+        if(DT > max_dt) suanpan_error("update_status() requires a time increment smaller than %.3E.\n", max_dt);
 
         C0 = 1. / DT / DT;
         C1 = .5 / DT;
@@ -61,13 +94,15 @@ void CentralDifference::assemble_resistance() {
 
     D->assemble_resistance();
 
-    D->assemble_mass();
-    D->assemble_damping();
+    if(!lumped) {
+        D->assemble_mass();
+        D->assemble_damping();
+    }
 
-    auto t_vector_a(std::async([&]() { return vec{ get_mass(W) * (C0 * (W->get_trial_displacement() + W->get_pre_displacement()) - C2 * W->get_current_displacement()) }; }));
-    auto t_vector_b(std::async([&]() { return vec{ get_damping(W) * C1 * (W->get_trial_displacement() - W->get_pre_displacement()) }; }));
+    vec t_vector_a, t_vector_b;
+    parallel_invoke([&] { t_vector_a = get_mass(W) * (C0 * (W->get_trial_displacement() + W->get_pre_displacement()) - C2 * W->get_current_displacement()); }, [&] { t_vector_b = get_damping(W) * (C1 * (W->get_trial_displacement() - W->get_pre_displacement())); });
 
-    get_sushi(W) += t_vector_a.get() + t_vector_b.get();
+    get_sushi(W) += t_vector_a + t_vector_b;
 }
 
 void CentralDifference::assemble_matrix() {
@@ -19,9 +19,15 @@
  * @brief A CentralDifference class defines a solver using Newmark
  * algorithm.
  *
+ * With the diagonal storage scheme, lumped mass and damping are assembled
+ * once in `initialize()` and kept constant, so that each increment only
+ * involves vector operations. The critical time step is estimated from the
+ * maximum frequency of all elements with lumped mass, which is an upper
+ * bound of the maximum frequency of the assembled system.
+ *
  * @author T
- * @date 29/07/2017
- * @version 0.1.0
+ * @date 23/10/2017
+ * @version 0.2.0
  * @file CentralDifference.h
  * @addtogroup Integrator
  * @{
@@ -32,7 +38,13 @@
 
 #include "Integrator.h"
 
+enum class LumpingScheme;
+
 class CentralDifference : public Integrator {
+    LumpingScheme lumping;
+
+    bool lumped = false; /**< lumped mass and damping are assembled */
+
     double max_dt = 1.;
 
     double DT = 0.;
@@ -46,6 +58,11 @@ public:
 
     int initialize() override;
 
+    void set_lumping_scheme(const LumpingScheme&);
+    const LumpingScheme& get_lumping_scheme() const;
+
+    const double& get_critical_step_size() const;
+
     void assemble_resistance() override;
     void assemble_matrix() override;
 
@@ -18,7 +18,7 @@
 #include "Newmark.h"
 #include <Domain/DomainBase.h>
 #include <Domain/Factory.hpp>
-#include <future>
+#include <Toolbox/ThreadPool.h>
 
 Newmark::Newmark(const unsigned& T, const double& A, const double& B)
     : Integrator(T, CT_NEWMARK)
@@ -38,10 +38,10 @@ void Newmark::assemble_resistance() {
     D->assemble_mass();
     D->assemble_damping();
 
-    auto t_vector_a(std::async([&]() { return vec{ get_mass(W) * (C2 * W->get_current_velocity() + C3 * W->get_current_acceleration() - C0 * W->get_incre_displacement()) }; }));
-    auto t_vector_b(std::async([&]() { return vec{ get_damping(W) * (C4 * W->get_current_velocity() + C5 * W->get_current_acceleration() - C1 * W->get_incre_displacement()) }; }));
+    vec t_vector_a, t_vector_b;
+    parallel_invoke([&] { t_vector_a = get_mass(W) * (C2 * W->get_current_velocity() + C3 * W->get_current_acceleration() - C0 * W->get_incre_displacement()); }, [&] { t_vector_b = get_damping(W) * (C4 * W->get_current_velocity() + C5 * W->get_current_acceleration() - C1 * W->get_incre_displacement()); });
 
-    get_sushi(W) -= t_vector_a.get() + t_vector_b.get();
+    get_sushi(W) -= t_vector_a + t_vector_b;
 }
 
 void Newmark::assemble_matrix() {
@@ -20,6 +20,7 @@
 #include <Domain/DomainBase.h>
 #include <Domain/Factory.hpp>
 #include <Solver/Integrator/Integrator.h>
+#include <Toolbox/Profiler.h>
 
 Newton::Newton(const unsigned& T)
     : Solver(T, CT_NEWTON) {}
@@ -36,22 +37,30 @@ int Newton::analyze() {
     // iteration counter
     unsigned counter = 0;
 
+    PhaseTimer T;
+
     while(true) {
         // assemble resistance
+        T.tic(ProfilePhase::RESISTANCE);
         G->assemble_resistance();
         // assemble stiffness
+        T.tic(ProfilePhase::STIFFNESS);
         G->assemble_matrix();
         // process loads
+        T.tic(ProfilePhase::LOAD);
         G->process_load();
         // process constraints
+        T.tic(ProfilePhase::CONSTRAINT);
         G->process_constraint();
 
         // call solver
+        T.tic(ProfilePhase::FACTORIZATION);
         const auto flag = W->get_stiffness()->solve(get_ninja(W), W->get_trial_load() - W->get_sushi());
         // make sure lapack solver succeeds
         if(flag != 0) return flag;
 
         // avoid machine error accumulation
+        T.tic(ProfilePhase::UPDATE);
         G->erase_machine_error();
         // update trial status for factory
         W->update_trial_displacement(W->get_trial_displacement() + W->get_ninja());
@@ -59,6 +68,7 @@ int Newton::analyze() {
         if(G->update_trial_status() != 0) return -1;
 
         // exit if converged
+        T.tic(ProfilePhase::CONVERGENCE);
         if(C->is_converged()) return 0;
         // exit if maximum iteration is hit
         if(++counter > max_iteration) return -1;
@@ -20,6 +20,7 @@
 #include <Domain/DomainBase.h>
 #include <Domain/Factory.hpp>
 #include <Solver/Integrator/Integrator.h>
+#include <Toolbox/Profiler.h>
 
 Ramm::Ramm(const unsigned& T)
     : Solver(T, CT_RAMM) {}
@@ -43,21 +44,29 @@ int Ramm::analyze() {
     // iteration counter
     unsigned counter = 0;
 
+    PhaseTimer T;
+
     while(true) {
         // assemble resistance
+        T.tic(ProfilePhase::RESISTANCE);
         G->assemble_resistance();
         // assemble stiffness
+        T.tic(ProfilePhase::STIFFNESS);
         G->assemble_matrix();
         // process loads
+        T.tic(ProfilePhase::LOAD);
         G->process_load();
         // process constraints
+        T.tic(ProfilePhase::CONSTRAINT);
         G->process_constraint();
 
         // solve ninja
+        T.tic(ProfilePhase::FACTORIZATION);
         auto flag = W->get_stiffness()->solve(t_ninja, load_ref * W->get_trial_load_factor() + W->get_trial_load() - W->get_sushi());
         // make sure lapack solver succeeds
         if(flag != 0) return flag;
         // solve reference displacement
+        T.tic(ProfilePhase::SOLVE);
         flag = W->get_stiffness()->solve_trs(disp_a, load_ref);
         // make sure lapack solver succeeds
         if(flag != 0) return flag;
@@ -81,6 +90,7 @@ int Ramm::analyze() {
         t_ninja += disp_a * t_lambda;
 
         // avoid machine error accumulation
+        T.tic(ProfilePhase::UPDATE);
         G->erase_machine_error();
         // update trial displacement
         W->update_trial_displacement(W->get_trial_displacement() + t_ninja);
@@ -94,6 +104,7 @@ int Ramm::analyze() {
         ++counter;
 
         // exit if converged
+        T.tic(ProfilePhase::CONVERGENCE);
         if(C->is_converged()) {
             if(!fixed_arc_length) arc_length *= sqrt(max_iteration / double(counter));
             return 0;
@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Theodore Chang
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Batch.h"
+#include <Domain/DomainBase.h>
+#include <Domain/Factory.hpp>
+#include <Domain/Node.h>
+#include <Element/Element.h>
+#include <Load/Load.h>
+#include <Recorder/Recorder.h>
+#include <Solver/Integrator/Integrator.h>
+
+Batch::Batch(const unsigned& T, const double& P, const bool& D)
+    : Step(T, CT_BATCH, P)
+    , dynamic(D) {}
+
+int Batch::analyze() {
+    auto& G = get_integrator();
+    const auto& D = get_domain().lock();
+    const auto& W = get_factory();
+
+    const auto& t_step = D->get_current_step_tag();
+    const auto is_active = [&](const shared_ptr<Load>& L) { return t_step >= L->get_start_step() && t_step < L->get_end_step(); };
+
+    // acceleration loads are patterns of mass, static batch needs mass as well
+    auto& t_pool = D->get_load_pool();
+    if(dynamic || std::any_of(t_pool.cbegin(), t_pool.cend(), [&](const shared_ptr<Load>& L) { return L->get_class_tag() == CT_ACCELERATION && is_active(L); })) D->assemble_mass();
+    if(dynamic) D->assemble_damping();
+
+    // each load with a fixed pattern is one case, the last column is reserved for the response without load
+    vector<shared_ptr<Load>> t_load_pool;
+    mat t_reference(W->get_size(), 0);
+    for(const auto& I : t_pool) {
+        if(!is_active(I)) continue;
+        const auto t_load = I->get_reference_load(D);
+        if(t_load.is_empty()) {
+            suanpan_warning("analyze() cannot batch Load %u, it is ignored.\n", I->get_tag());
+            continue;
+        }
+        t_load_pool.emplace_back(I);
+        t_reference.insert_cols(t_reference.n_cols, t_load);
+    }
+
+    if(t_load_pool.empty()) {
+        suanpan_error("analyze() finds no load to batch.\n");
+        return -1;
+    }
+
+    const auto n_case = unsigned(t_load_pool.size());
+
+    t_reference.insert_cols(n_case, 1);
+
+    // increments are measured from the committed state
+    const vec t_dsp = W->get_current_displacement();
+    const vec t_resistance = W->get_current_resistance();
+
+    vec t_amplitude(n_case + 1, fill::zeros);
+    const auto get_load = [&](const double& T) {
+        for(unsigned I = 0; I < n_case; ++I) t_amplitude(I) = t_load_pool[I]->get_amplitude(T);
+        mat t_load = t_reference * diagmat(t_amplitude);
+        t_load.each_col() -= t_resistance;
+        return t_load;
+    };
+
+    const auto num_increment = unsigned(std::max(1., std::ceil(get_time_period() / get_ini_step_size() - 1E-10)));
+    const auto DT = get_time_period() / num_increment;
+    const auto C0 = 4. / DT / DT;
+    const auto C1 = 2. / DT;
+    const auto C2 = 2. * C1;
+    const auto C3 = .5 * DT;
+
+    // the system is factorized once
+    D->assemble_stiffness();
+    if(dynamic) get_stiffness(W) += C0 * get_mass(W) + C1 * get_damping(W);
+    G->process_constraint();
+
+    auto& t_stiffness = W->get_stiffness();
+
+    mat t_u(W->get_size(), n_case + 1, fill::zeros), t_v, t_a, t_x;
+    if(dynamic) {
+        t_v = repmat(W->get_current_velocity(), 1, n_case + 1);
+        t_a = repmat(W->get_current_acceleration(), 1, n_case + 1);
+    } else {
+        mat t_rhs = t_reference;
+        t_rhs.col(n_case) = -t_resistance;
+        for(const auto& I : D->get_restrained_dof()) t_rhs.row(I).zeros();
+        if(t_stiffness->solve(t_x, t_rhs) != 0) {
+            suanpan_error("analyze() fails to solve the system.\n");
+            return -1;
+        }
+    }
+
+    // recover only what recorders ask for
+    vector<shared_ptr<Recorder>> t_recorder_pool;
+    vector<shared_ptr<Node>> t_node_pool;
+    vector<shared_ptr<Element>> t_element_pool;
+    {
+        unordered_set<unsigned> t_node_tag;
+        for(const auto& I : D->get_recorder_pool()) {
+            if(!I->is_active()) continue;
+            t_recorder_pool.emplace_back(I);
+            // streamed records have a fixed width, each case is streamed as one record
+            if(!I->is_stream()) I->set_batch_size(n_case);
+            if(I->get_class_tag() == CT_NODERECORDER)
+                for(const auto& J : I->get_object_tag()) t_node_tag.insert(unsigned(J));
+            else if(I->get_class_tag() == CT_ELEMENTRECORDER)
+                for(const auto& J : I->get_object_tag()) {
+                    if(!D->find_element(unsigned(J))) continue;
+                    auto& t_element = D->get_element(unsigned(J));
+                    if(!t_element->is_active()) continue;
+                    t_element_pool.emplace_back(t_element);
+                    for(const auto& K : t_element->get_node_encoding()) t_node_tag.insert(unsigned(K));
+                }
+        }
+        for(const auto& I : t_node_tag) {
+            if(!D->find_node(I)) continue;
+            auto& t_node = D->get_node(I);
+            if(t_node->is_active()) t_node_pool.emplace_back(t_node);
+        }
+    }
+
+    auto t_time = W->get_current_time();
+
+    for(unsigned I = 0; I < num_increment; ++I) {
+        t_time += DT;
+
+        if(dynamic) {
+            mat t_rhs = get_load(t_time) + get_mass(W) * mat(C0 * t_u + C2 * t_v + t_a) + get_damping(W) * mat(C1 * t_u + t_v);
+            for(const auto& J : D->get_restrained_dof()) t_rhs.row(J).zeros();
+            mat t_new_u;
+            if((t_stiffness->factored ? t_stiffness->solve_trs(t_new_u, t_rhs) : t_stiffness->solve(t_new_u, t_rhs)) != 0) {
+                suanpan_error("analyze() fails to solve the system.\n");
+                return -1;
+            }
+            const mat t_new_a = C0 * (t_new_u - t_u) - C2 * t_v - t_a;
+            t_v += C3 * (t_a + t_new_a);
+            t_a = t_new_a;
+            t_u = t_new_u;
+        } else {
+            for(unsigned J = 0; J < n_case; ++J) t_amplitude(J) = t_load_pool[J]->get_amplitude(t_time);
+            t_amplitude(n_case) = 1.;
+            t_u = t_x * diagmat(t_amplitude);
+            // each case contains the response without load, same as the dynamic branch
+            t_u.head_cols(n_case).each_col() += t_x.col(n_case);
+        }
+
+        W->update_current_time(t_time);
+
+        for(unsigned J = 0; J < n_case; ++J) {
+            for(const auto& K : t_node_pool) {
+                auto& t_dof = K->get_reordered_dof();
+                const vec t_trial_u = t_dsp(t_dof) + t_u(t_dof, uvec{ J });
+                K->set_trial_displacement(t_trial_u);
+                K->set_current_displacement(t_trial_u);
+                if(!dynamic) continue;
+                const vec t_trial_v = t_v(t_dof, uvec{ J });
+                const vec t_trial_a = t_a(t_dof, uvec{ J });
+                K->set_trial_velocity(t_trial_v);
+                K->set_trial_acceleration(t_trial_a);
+                K->set_current_velocity(t_trial_v);
+                K->set_current_acceleration(t_trial_a);
+            }
+
+            for(const auto& K : t_element_pool) {
+                if(K->update_status() != 0) return -1;
+                K->Element::commit_status();
+                K->commit_status();
+            }
+
+            for(const auto& K : t_recorder_pool) K->record(D);
+        }
+    }
+
+    for(const auto& I : t_recorder_pool) I->set_batch_size(1);
+
+    // the linear response under all loads is the sum of all cases minus the duplicated response without load
+    const auto get_combination = [&](const mat& X) { return vec(sum(X, 1) - double(n_case) * X.col(n_case)); };
+
+    W->update_trial_displacement(t_dsp + get_combination(t_u));
+    if(dynamic) {
+        W->update_trial_velocity(get_combination(t_v));
+        W->update_trial_acceleration(get_combination(t_a));
+    }
+    if(G->update_trial_status() != 0) return -1;
+    D->commit_status();
+
+    return 0;
+}
+
+const bool& Batch::is_dynamic() const { return dynamic; }
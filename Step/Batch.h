@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * Copyright (C) 2017 Theodore Chang
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+/**
+ * @class Batch
+ * @brief A Batch class defines batched linear analysis of multiple cases.
+ *
+ * Each active load that can be expressed as a fixed pattern times an
+ * amplitude (CLoad and Acceleration) defines one case. The patterns are
+ * carried as columns of one matrix, the stiffness (static) or the effective
+ * stiffness of the average acceleration method (dynamic) is factorized once
+ * and all cases are advanced together by one solve with multiple right-hand
+ * sides per increment.
+ *
+ * All cases start from the committed state. Within the step, active
+ * recorders receive one record per case, which are stored side by side in
+ * one column. At the end of the step, the response under all loads acting
+ * together, obtained by superposition, is committed so that following steps
+ * see the same state as an ordinary step would produce.
+ *
+ * The analysis is linear, the system is linearized at the start of the step.
+ *
+ * @author T
+ * @date 26/10/2017
+ * @version 0.1.0
+ * @file Batch.h
+ * @addtogroup Step
+ * @{
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <Step/Step.h>
+
+class Batch : public Step {
+    bool dynamic;
+
+public:
+    explicit Batch(const unsigned& = 0, const double& = 1., const bool& = false);
+
+    int analyze() override;
+
+    const bool& is_dynamic() const;
+};
+
+#endif
+
+//! @}
@@ -17,12 +17,34 @@
 
 #include "Bead.h"
 #include <Domain/Domain.h>
+#include <Recorder/Recorder.h>
 #include <Step/Step.h>
+#include <Toolbox/ThreadPool.h>
+#include <Toolbox/utility.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace {
+int analyze_domain(const shared_ptr<DomainBase>& D) {
+    auto code = 0;
+    for(const auto& J : D->get_step_pool()) {
+        // steps finished before a restart are disabled
+        if(!J.second->is_active()) continue;
+        D->set_current_step_tag(J.second->get_tag());
+        code += J.second->analyze();
+    }
+
+    return code;
+}
+}
 
 Bead::Bead() { insert(make_shared<Domain>(1)); }
 
 bool Bead::insert(const shared_ptr<DomainBase>& D) { return domain_pool.insert(D); }
 
+bool Bead::find_domain(const unsigned& T) const { return domain_pool.find(T); }
+
 void Bead::erase_domain(const unsigned& T) {
     if(!domain_pool.find(T))
         suanpan_info("erase_domain() cannot find Domain %u, nothing changed.\n", T);
@@ -51,16 +73,78 @@ const shared_ptr<DomainBase>& Bead::get_domain(const unsigned& T) const { return
 
 const shared_ptr<DomainBase>& Bead::get_current_domain() const { return domain_pool.at(current_domain_tag); }
 
-int Bead::analyze() {
-    auto code = 0;
+void Bead::set_thread_number(const unsigned& N) { thread_number = std::max(1u, N); }
+
+const unsigned& Bead::get_thread_number() const { return thread_number; }
 
+int Bead::analyze() {
+    vector<shared_ptr<DomainBase>> t_pool;
     for(const auto& I : domain_pool)
-        if(I.second->is_active() && I.second->initialize() == 0) {
-            for(const auto& J : I.second->get_step_pool()) {
-                I.second->set_current_step_tag(J.second->get_tag());
-                code += J.second->analyze();
+        if(I.second->is_active()) t_pool.emplace_back(I.second);
+
+    if(thread_number == 1 || t_pool.size() < 2) {
+        auto code = 0;
+        for(const auto& I : t_pool)
+            if(I->initialize() == 0) code += analyze_domain(I);
+        return code;
+    }
+
+    // domains without steps, such as the default one holding no model, are not reported
+    t_pool.erase(std::remove_if(t_pool.begin(), t_pool.end(), [](const shared_ptr<DomainBase>& D) { return D->get_step_pool().empty(); }), t_pool.end());
+
+    std::sort(t_pool.begin(), t_pool.end(), [](const shared_ptr<DomainBase>& A, const shared_ptr<DomainBase>& B) { return A->get_tag() < B->get_tag(); });
+
+    const auto n_domain = t_pool.size();
+    const auto n_worker = std::min(size_t(thread_number), n_domain);
+
+    vector<int> t_code(n_domain, 0);
+    vector<char> t_initialized(n_domain, 0);
+    vector<double> t_time(n_domain, 0.);
+    std::atomic<size_t> t_next(0);
+
+    const auto t_task = [&]() {
+        // each worker owns one domain at a time, nested loops run in serial
+        set_thread_limit(1);
+        for(auto I = t_next++; I < n_domain; I = t_next++) {
+            wall_clock T;
+            T.tic();
+            try {
+                t_initialized[I] = t_pool[I]->initialize() == 0;
+                if(t_initialized[I]) t_code[I] = analyze_domain(t_pool[I]);
+                // records are written as soon as the domain finishes
+                for(const auto& J : t_pool[I]->get_recorder_pool()) J->save();
+            } catch(const std::exception& E) {
+                suanpan_error("analyze() catches an exception in Domain %u: %s\n", t_pool[I]->get_tag(), E.what());
+                t_code[I] = -1;
             }
+            t_time[I] = T.toc();
         }
+    };
+
+    const auto t_blas_thread = get_blas_thread();
+    set_blas_thread(1);
+
+    wall_clock T;
+    T.tic();
+
+    vector<std::thread> t_worker;
+    t_worker.reserve(n_worker);
+    for(size_t I = 0; I < n_worker; ++I) t_worker.emplace_back(t_task);
+    for(auto& I : t_worker) I.join();
+
+    const auto t_total = T.toc();
+
+    set_blas_thread(t_blas_thread);
+
+    auto code = 0;
+    unsigned n_fail = 0;
+    for(size_t I = 0; I < n_domain; ++I) {
+        const auto t_success = t_initialized[I] && t_code[I] == 0;
+        if(!t_success) ++n_fail;
+        if(t_initialized[I]) code += t_code[I];
+        suanpan_info("Domain %u %s in %.3F seconds.\n", t_pool[I]->get_tag(), t_success ? "finishes" : "fails", t_time[I]);
+    }
+    suanpan_info("analyze() finishes %u domains by %u threads in %.3F seconds, %u failed.\n", unsigned(n_domain), unsigned(n_worker), t_total, n_fail);
 
     return code;
 }
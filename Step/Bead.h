@@ -17,6 +17,13 @@
 /**
  * @class Bead
  * @brief A Bead class is a top level container.
+ *
+ * Domains are independent of each other. When more than one thread is
+ * assigned, active domains are analyzed concurrently by a pool of workers,
+ * each domain is handled by one worker with nested parallelism and BLAS
+ * threading limited to one thread. Records of each domain are saved once
+ * its analysis finishes. Timings and failures of all domains are summarized
+ * at the end.
  * @author T
  * @date 01/10/2017
  * @version 0.3.0
@@ -33,12 +40,15 @@ class DomainBase;
 class Bead {
     unsigned current_domain_tag = 1;
 
+    unsigned thread_number = 1; /**< number of domains analyzed concurrently */
+
     DomainBaseStorage domain_pool;
 
 public:
     Bead();
 
     bool insert(const shared_ptr<DomainBase>&);
+    bool find_domain(const unsigned&) const;
     void erase_domain(const unsigned&);
     void enable_domain(const unsigned&);
     void disable_domain(const unsigned&);
@@ -46,6 +56,9 @@ public:
     void set_current_domain_tag(const unsigned&);
     const unsigned& get_current_domain_tag() const;
 
+    void set_thread_number(const unsigned&);
+    const unsigned& get_thread_number() const;
+
     const shared_ptr<DomainBase>& get_domain(const unsigned&) const;
     const shared_ptr<DomainBase>& get_current_domain() const;
 
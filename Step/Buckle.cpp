@@ -16,12 +16,68 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Buckle.h"
-#include <Domain/Domain.h>
+#include <Domain/DomainBase.h>
 #include <Domain/Factory.hpp>
+#include <Solver/Integrator/Integrator.h>
+#include <Toolbox/arpack_wrapper.h>
 
 Buckle::Buckle(const unsigned& T, const unsigned& N)
-    : Step(T, CT_FREQUENCE, 0.) {}
+    : Step(T, CT_BUCKLE, 1.)
+    , eigen_number(N) {}
 
-int Buckle::initialize() { return 0; }
+int Buckle::initialize() { return Step::initialize(); }
 
-int Buckle::analyze() { return 0; }
+int Buckle::analyze() {
+    auto& G = get_integrator();
+    const auto& D = get_domain().lock();
+    const auto& W = get_factory();
+
+    // apply reference load in one increment
+    G->update_incre_time(get_time_period());
+
+    // assemble resistance
+    G->assemble_resistance();
+    // assemble elastic stiffness
+    D->assemble_initial_stiffness();
+    // process loads
+    G->process_load();
+    // process constraints
+    G->process_constraint();
+
+    // linear solution, the factorization is reused by eigen solver
+    auto& t_stiffness = W->get_stiffness();
+    if(t_stiffness->solve(get_ninja(W), W->get_trial_load() - W->get_sushi()) != 0) return -1;
+
+    W->update_trial_displacement(W->get_trial_displacement() + W->get_ninja());
+    if(G->update_trial_status() != 0) return -1;
+
+    // geometry matrix of current stress state
+    D->assemble_geometry();
+
+    auto& t_geometry = W->get_geometry();
+    if(std::all_of(t_geometry->memptr(), t_geometry->memptr() + t_geometry->n_elem, [](const double t_value) { return t_value == 0.; })) {
+        suanpan_error("analyze() finds no geometry matrix, elements with nonlinear geometry are required.\n");
+        G->reset_status();
+        return -1;
+    }
+
+    const auto code = buckle_solve(get_eigenvalue(W), get_eigenvector(W), t_stiffness, t_geometry, eigen_number);
+
+    // the reference state is not committed
+    G->reset_status();
+
+    if(code != 0) {
+        suanpan_error("analyze() fails to solve the buckling problem.\n");
+        return -1;
+    }
+
+    suanpan_info("\nCritical load factors:\n");
+    for(const auto& I : W->get_eigenvalue()) suanpan_info("%+.6E\n", I);
+    suanpan_info("\n");
+
+    return 0;
+}
+
+void Buckle::set_eigen_number(const unsigned& N) { eigen_number = N; }
+
+const unsigned& Buckle::get_eigen_number() const { return eigen_number; }
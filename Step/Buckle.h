@@ -16,10 +16,14 @@
  ******************************************************************************/
 /**
  * @class Buckle
- * @brief A Buckle class.
+ * @brief A Buckle class performs linear buckling analysis.
+ *
+ * The structure is analyzed linearly under the reference load, the stress
+ * state defines the geometry matrix G and the critical load factors solve
+ * (K+lambda*G)*x=0. Only elements that provide a geometry matrix contribute.
  * @author T
  * @date 11/10/2017
- * @version 0.1.0
+ * @version 0.2.0
  * @file Buckle.h
  * @addtogroup Step
  * @{
@@ -31,12 +35,17 @@
 #include <Step/Step.h>
 
 class Buckle : public Step {
+    unsigned eigen_number;
+
 public:
     explicit Buckle(const unsigned& = 0, const unsigned& = 4);
 
     int initialize() override;
 
     int analyze() override;
+
+    void set_eigen_number(const unsigned&);
+    const unsigned& get_eigen_number() const;
 };
 
 #endif
@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Theodore Chang
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ExplicitDynamic.h"
+#include <Domain/DomainBase.h>
+#include <Domain/Factory.hpp>
+#include <Solver/Integrator/CentralDifference.h>
+
+ExplicitDynamic::ExplicitDynamic(const unsigned& T, const double& P)
+    : Step(T, CT_EXPLICITDYNAMIC, P) {}
+
+int ExplicitDynamic::analyze() {
+    const auto G = std::dynamic_pointer_cast<CentralDifference>(get_integrator());
+    if(G == nullptr) {
+        suanpan_error("analyze() requires a central difference integrator.\n");
+        return -1;
+    }
+
+    const auto& W = G->get_domain().lock()->get_factory();
+    if(W->get_storage_scheme() != StorageScheme::DIAGONAL) {
+        suanpan_error("analyze() requires lumped mass, explicit steps cannot be mixed with other steps.\n");
+        return -1;
+    }
+
+    // lumped mass and critical time step
+    if(G->initialize() != 0) return -1;
+
+    auto time_left = get_time_period();
+    const auto step = std::min(get_ini_step_size(), safety_factor * G->get_critical_step_size());
+
+    suanpan_info("analyze() uses a time increment of %.3E.\n", step);
+
+    while(true) {
+        // check if the target time point is hit
+        if(time_left <= 1E-14) return 0;
+        // update incremental and trial time
+        G->update_incre_time(std::min(step, time_left));
+        // assemble effective load and diagonal effective mass
+        G->assemble_resistance();
+        G->assemble_matrix();
+        G->process_load();
+        G->process_constraint();
+        // no factorization is involved for diagonal matrices
+        if(W->get_stiffness()->solve(get_ninja(W), W->get_trial_load() - W->get_sushi()) != 0) return -1;
+        // avoid machine error accumulation
+        G->erase_machine_error();
+        W->update_trial_displacement(W->get_trial_displacement() + W->get_ninja());
+        // update for nodes and elements
+        if(G->update_trial_status() != 0) return -1;
+        // commit and record
+        G->commit_status();
+        G->record();
+        // eat current increment
+        time_left -= std::min(step, time_left);
+    }
+}
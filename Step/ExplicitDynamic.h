@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Copyright (C) 2017 Theodore Chang
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+/**
+ * @class ExplicitDynamic
+ * @brief A ExplicitDynamic class defines explicit dynamic analysis.
+ *
+ * The step uses the central difference method with lumped mass and damping
+ * stored in diagonal matrices. Each increment is a single pass without
+ * equilibrium iterations. The increment is bounded by a fraction of the
+ * critical time step estimated by the integrator.
+ *
+ * @author T
+ * @date 23/10/2017
+ * @version 0.1.0
+ * @file ExplicitDynamic.h
+ * @addtogroup Step
+ * @{
+ */
+
+#ifndef EXPLICITDYNAMIC_H
+#define EXPLICITDYNAMIC_H
+
+#include <Step/Step.h>
+
+class ExplicitDynamic : public Step {
+    const double safety_factor = .9; /**< fraction of critical time step */
+public:
+    explicit ExplicitDynamic(const unsigned& = 0, const double& = 1.);
+
+    int analyze() override;
+};
+
+#endif
+
+//! @}
@@ -16,16 +16,46 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "Frequence.h"
-#include <Solver/Solver.h>
+#include <Domain/DomainBase.h>
+#include <Domain/Factory.hpp>
+#include <Solver/Arnoldi.h>
 
-Frequence::Frequence(const unsigned& T, const unsigned& N)
+Frequence::Frequence(const unsigned& T, const unsigned& N, const double& S)
     : Step(T, CT_FREQUENCE, 0.)
-    , eigen_number(N) {}
+    , eigen_number(N)
+    , shift(S) {}
 
-int Frequence::initialize() { return 0; }
+int Frequence::initialize() {
+    // shifted stiffness is indefinite in general, Cholesky based symmetric storage cannot be used
+    if(shift != 0.) set_symm(false);
 
-int Frequence::analyze() { return get_solver()->analyze(); }
+    const auto code = Step::initialize();
+    if(code != 0) return code;
+
+    const auto t_solver = std::dynamic_pointer_cast<Arnoldi>(get_solver());
+    t_solver->set_eigen_number(eigen_number);
+    t_solver->set_shift(shift);
+
+    return 0;
+}
+
+int Frequence::analyze() {
+    const auto code = get_solver()->analyze();
+
+    if(code == 0) {
+        const auto& t_eigenvalue = get_factory()->get_eigenvalue();
+        suanpan_info("\nEigenvalues:\n");
+        for(const auto& I : t_eigenvalue) suanpan_info("%+.6E\n", I);
+        suanpan_info("\n");
+    }
+
+    return code;
+}
 
 void Frequence::set_eigen_number(const unsigned& N) { eigen_number = N; }
 
 const unsigned& Frequence::get_eigen_number() const { return eigen_number; }
+
+void Frequence::set_shift(const double& S) { shift = S; }
+
+const double& Frequence::get_shift() const { return shift; }
@@ -32,9 +32,10 @@
 
 class Frequence : public Step {
     unsigned eigen_number;
+    double shift; /**< eigenvalues closest to the shift are found */
 
 public:
-    explicit Frequence(const unsigned& = 0, const unsigned& = 4);
+    explicit Frequence(const unsigned& = 0, const unsigned& = 4, const double& = 0.);
 
     int initialize() override;
 
@@ -42,6 +43,9 @@ public:
 
     void set_eigen_number(const unsigned&);
     const unsigned& get_eigen_number() const;
+
+    void set_shift(const double&);
+    const double& get_shift() const;
 };
 
 #endif
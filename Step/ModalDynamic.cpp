@@ -0,0 +1,187 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Theodore Chang
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ModalDynamic.h"
+#include <Domain/DomainBase.h>
+#include <Domain/Factory.hpp>
+#include <Domain/Node.h>
+#include <Element/Element.h>
+#include <Load/Load.h>
+#include <Recorder/Recorder.h>
+#include <Solver/Integrator/Integrator.h>
+#include <Toolbox/arpack_wrapper.h>
+
+ModalDynamic::ModalDynamic(const unsigned& T, const double& P, const unsigned& N, const double& R)
+    : Step(T, CT_MODALDYNAMIC, P)
+    , mode_number(N)
+    , damping_ratio(R) {}
+
+int ModalDynamic::analyze() {
+    auto& G = get_integrator();
+    const auto& D = get_domain().lock();
+    const auto& W = get_factory();
+
+    // linearize at the start of current step
+    D->assemble_mass();
+    D->assemble_damping();
+    D->assemble_stiffness();
+    G->process_constraint();
+
+    vec t_eigval;
+    mat t_phi;
+    if(eig_solve(t_eigval, t_phi, W->get_stiffness(), W->get_mass(), mode_number) != 0) {
+        suanpan_error("analyze() fails to solve the eigen problem.\n");
+        return -1;
+    }
+
+    for(const auto& I : D->get_restrained_dof()) t_phi.row(I).zeros();
+
+    // mass normalized modes, banded storage only supports products with vectors
+    mat t_mphi(size(t_phi)), t_cphi(size(t_phi));
+    for(uword I = 0; I < t_phi.n_cols; ++I) {
+        const vec t_mode = t_phi.col(I);
+        t_mphi.col(I) = get_mass(W) * t_mode;
+        t_cphi.col(I) = get_damping(W) * t_mode;
+    }
+    const rowvec t_norm = sqrt(sum(t_phi % t_mphi));
+    t_phi.each_row() /= t_norm;
+    t_mphi.each_row() /= t_norm;
+    t_cphi.each_row() /= t_norm;
+
+    const vec t_omega = sqrt(clamp(t_eigval, 0., datum::inf));
+    const vec t_stiffness = square(t_omega);
+    const vec t_damping = 2. * damping_ratio * t_omega + sum(t_phi % t_cphi).t();
+
+    suanpan_info("analyze() superposes %u modes, the highest frequency is %.3E Hz.\n", unsigned(t_omega.n_elem), .5 * t_omega.max() / datum::pi);
+
+    // project loads onto modal coordinates
+    const auto& t_step = D->get_current_step_tag();
+    vector<shared_ptr<Load>> t_load_pool;
+    mat t_modal_load(t_phi.n_cols, 0);
+    for(const auto& I : D->get_load_pool()) {
+        if(t_step < I->get_start_step() || t_step >= I->get_end_step()) continue;
+        const auto t_load = I->get_reference_load(D);
+        if(t_load.is_empty()) {
+            suanpan_warning("analyze() cannot project Load %u onto modal coordinates, it is ignored.\n", I->get_tag());
+            continue;
+        }
+        t_load_pool.emplace_back(I);
+        t_modal_load.insert_cols(t_modal_load.n_cols, t_phi.t() * t_load);
+    }
+
+    // increments are measured from the committed state
+    const vec t_dsp = W->get_current_displacement();
+    const vec t_vel = W->get_current_velocity();
+    const vec t_initial_load = t_phi.t() * W->get_current_resistance();
+
+    vec t_amplitude(t_load_pool.size());
+    const auto get_modal_load = [&](const double& T) {
+        for(uword I = 0; I < t_amplitude.n_elem; ++I) t_amplitude(I) = t_load_pool[I]->get_amplitude(T);
+        return vec(t_modal_load * t_amplitude - t_initial_load);
+    };
+
+    auto t_time = W->get_current_time();
+
+    vec t_q(t_phi.n_cols, fill::zeros);
+    vec t_dq = t_mphi.t() * t_vel;
+    vec t_ddq = get_modal_load(t_time) - t_damping % t_dq;
+
+    // recover only what recorders ask for
+    vector<std::pair<shared_ptr<Node>, mat>> t_node_pool;
+    vector<shared_ptr<Element>> t_element_pool;
+    {
+        unordered_set<unsigned> t_node_tag;
+        for(const auto& I : D->get_recorder_pool()) {
+            if(!I->is_active()) continue;
+            if(I->get_class_tag() == CT_NODERECORDER)
+                for(const auto& J : I->get_object_tag()) t_node_tag.insert(unsigned(J));
+            else if(I->get_class_tag() == CT_ELEMENTRECORDER)
+                for(const auto& J : I->get_object_tag()) {
+                    if(!D->find_element(unsigned(J))) continue;
+                    auto& t_element = D->get_element(unsigned(J));
+                    if(!t_element->is_active()) continue;
+                    t_element_pool.emplace_back(t_element);
+                    for(const auto& K : t_element->get_node_encoding()) t_node_tag.insert(unsigned(K));
+                }
+        }
+        for(const auto& I : t_node_tag) {
+            if(!D->find_node(I)) continue;
+            auto& t_node = D->get_node(I);
+            if(t_node->is_active()) t_node_pool.emplace_back(t_node, t_phi.rows(t_node->get_reordered_dof()));
+        }
+    }
+
+    // average acceleration method with fixed step size
+    const auto num_increment = unsigned(std::max(1., std::ceil(get_time_period() / get_ini_step_size() - 1E-10)));
+    const auto DT = get_time_period() / num_increment;
+    const auto C0 = 4. / DT / DT;
+    const auto C1 = 2. / DT;
+    const auto C2 = 2. * C1;
+    const auto C3 = .5 * DT;
+    const vec t_effective = t_stiffness + C0 + C1 * t_damping;
+
+    for(unsigned I = 0; I < num_increment; ++I) {
+        t_time += DT;
+
+        const vec t_new_q = (get_modal_load(t_time) + C0 * t_q + C2 * t_dq + t_ddq + t_damping % (C1 * t_q + t_dq)) / t_effective;
+        const vec t_new_ddq = C0 * (t_new_q - t_q) - C2 * t_dq - t_ddq;
+        t_dq += C3 * (t_ddq + t_new_ddq);
+        t_ddq = t_new_ddq;
+        t_q = t_new_q;
+
+        W->update_current_time(t_time);
+
+        for(const auto& J : t_node_pool) {
+            auto& t_node = J.first;
+            auto& t_dof = t_node->get_reordered_dof();
+            const vec t_u = t_dsp(t_dof) + J.second * t_q;
+            const vec t_v = J.second * t_dq;
+            const vec t_a = J.second * t_ddq;
+            t_node->set_trial_displacement(t_u);
+            t_node->set_trial_velocity(t_v);
+            t_node->set_trial_acceleration(t_a);
+            t_node->set_current_displacement(t_u);
+            t_node->set_current_velocity(t_v);
+            t_node->set_current_acceleration(t_a);
+        }
+
+        for(const auto& J : t_element_pool) {
+            if(J->update_status() != 0) return -1;
+            J->Element::commit_status();
+            J->commit_status();
+        }
+
+        G->record();
+    }
+
+    // recover and commit full state
+    W->update_trial_displacement(t_dsp + t_phi * t_q);
+    W->update_trial_velocity(t_phi * t_dq);
+    W->update_trial_acceleration(t_phi * t_ddq);
+    if(G->update_trial_status() != 0) return -1;
+    D->commit_status();
+
+    return 0;
+}
+
+void ModalDynamic::set_mode_number(const unsigned& N) { mode_number = N; }
+
+const unsigned& ModalDynamic::get_mode_number() const { return mode_number; }
+
+void ModalDynamic::set_damping_ratio(const double& R) { damping_ratio = R; }
+
+const double& ModalDynamic::get_damping_ratio() const { return damping_ratio; }
@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Copyright (C) 2017 Theodore Chang
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+/**
+ * @class ModalDynamic
+ * @brief A ModalDynamic class defines dynamic analysis by modal superposition.
+ *
+ * The first N modes of the system linearized at the start of the step are
+ * computed once. Loads that can be expressed as a fixed pattern times an
+ * amplitude (CLoad and Acceleration) are projected onto the modal
+ * coordinates, and the decoupled equations are integrated together by the
+ * average acceleration method with a fixed step size. Within the step, only
+ * the nodes and elements referenced by active recorders are recovered, the
+ * full state is recovered and committed at the end of the step.
+ *
+ * Modal damping is the given damping ratio plus the diagonal of the projected
+ * damping matrix.
+ *
+ * @author T
+ * @date 25/10/2017
+ * @version 0.1.0
+ * @file ModalDynamic.h
+ * @addtogroup Step
+ * @{
+ */
+
+#ifndef MODALDYNAMIC_H
+#define MODALDYNAMIC_H
+
+#include <Step/Step.h>
+
+class ModalDynamic : public Step {
+    unsigned mode_number;
+    double damping_ratio;
+
+public:
+    explicit ModalDynamic(const unsigned& = 0, const double& = 1., const unsigned& = 10, const double& = 0.);
+
+    int analyze() override;
+
+    void set_mode_number(const unsigned&);
+    const unsigned& get_mode_number() const;
+
+    void set_damping_ratio(const double&);
+    const double& get_damping_ratio() const;
+};
+
+#endif
+
+//! @}
@@ -19,6 +19,8 @@
 #include <Converger/RelIncreDisp.h>
 #include <Domain/DomainBase.h>
 #include <Domain/Factory.hpp>
+#include <Solver/Arnoldi.h>
+#include <Solver/Integrator/CentralDifference.h>
 #include <Solver/Integrator/Newmark.h>
 #include <Solver/Newton.h>
 #include <Solver/Ramm.h>
@@ -46,9 +48,15 @@ int Step::initialize() {
         break;
     case CT_STATIC:
     case CT_DYNAMIC:
+    case CT_EXPLICITDYNAMIC:
+    case CT_MODALDYNAMIC:
+    case CT_BATCH:
+    case CT_BUCKLE:
         if(solver == nullptr) solver = make_shared<Newton>();
         break;
     case CT_FREQUENCE:
+        // eigen analysis can only be performed by Arnoldi solver
+        if(solver == nullptr || solver->get_class_tag() != CT_ARNOLDI) solver = make_shared<Arnoldi>();
         break;
     default:
         suanpan_error("initialize() needs a valid step.\n");
@@ -59,7 +67,13 @@ int Step::initialize() {
 
     factory = t_domain->get_factory();
 
-    if(get_class_tag() != CT_ARCLENGTH) {
+    // explicit analysis stores lumped mass in diagonal matrices
+    if(get_class_tag() == CT_EXPLICITDYNAMIC)
+        factory->set_storage_scheme(StorageScheme::DIAGONAL);
+    // iterative solvers work on the sparse storage only
+    else if(sparse_mat || iterative_setting.solver != IterativeSolver::NONE)
+        factory->set_storage_scheme(StorageScheme::SPARSE);
+    else if(get_class_tag() != CT_ARCLENGTH) {
         if(symm_mat && band_mat)
             factory->set_storage_scheme(StorageScheme::BANDSYMM);
         else if(!symm_mat && band_mat)
@@ -79,12 +93,32 @@ int Step::initialize() {
         modifier->set_domain(t_domain);
         break;
     case CT_DYNAMIC:
+    case CT_MODALDYNAMIC:
         factory->set_analysis_type(AnalysisType::DYNAMICS);
         if(modifier == nullptr) modifier = make_shared<Newmark>();
         modifier->set_domain(t_domain);
         break;
+    case CT_BATCH:
+        // mass and damping are only used in dynamic batch
+        factory->set_analysis_type(AnalysisType::DYNAMICS);
+        if(modifier == nullptr) modifier = make_shared<Integrator>();
+        modifier->set_domain(t_domain);
+        break;
+    case CT_EXPLICITDYNAMIC:
+        factory->set_analysis_type(AnalysisType::DYNAMICS);
+        // explicit analysis can only be performed by central difference
+        if(modifier == nullptr || modifier->get_class_tag() != CT_CENTRALDIFFERENCE) modifier = make_shared<CentralDifference>();
+        modifier->set_domain(t_domain);
+        break;
+    case CT_BUCKLE:
+        factory->set_analysis_type(AnalysisType::BUCKLE);
+        if(modifier == nullptr) modifier = make_shared<Integrator>();
+        modifier->set_domain(t_domain);
+        break;
     case CT_FREQUENCE:
         factory->set_analysis_type(AnalysisType::EIGEN);
+        if(modifier == nullptr) modifier = make_shared<Integrator>();
+        modifier->set_domain(t_domain);
         break;
     default:
         suanpan_error("initialize() needs a valid step.\n");
@@ -93,6 +127,8 @@ int Step::initialize() {
 
     factory->initialize();
 
+    factory->set_iterative_setting(iterative_setting);
+
     tester->set_domain(t_domain);
     solver->set_converger(tester);
     solver->set_integrator(modifier);
@@ -221,6 +257,8 @@ const bool& Step::is_symm() const { return symm_mat; }
 
 const bool& Step::is_band() const { return band_mat; }
 
+const bool& Step::is_sparse() const { return sparse_mat; }
+
 void Step::set_symm(const bool& B) {
     if(symm_mat != B) {
         symm_mat = B;
@@ -234,3 +272,40 @@ void Step::set_band(const bool& B) {
         updated = false;
     }
 }
+
+void Step::set_sparse(const bool& B) {
+    if(sparse_mat != B) {
+        sparse_mat = B;
+        updated = false;
+    }
+}
+
+void Step::set_iterative_solver(const IterativeSolver& S) {
+    if(iterative_setting.solver != S) {
+        iterative_setting.solver = S;
+        updated = false;
+    }
+}
+
+void Step::set_preconditioner(const PreconditionerType& P) {
+    if(iterative_setting.preconditioner != P) {
+        iterative_setting.preconditioner = P;
+        updated = false;
+    }
+}
+
+void Step::set_iterative_tolerance(const double& T) {
+    if(iterative_setting.tolerance != T) {
+        iterative_setting.tolerance = T;
+        updated = false;
+    }
+}
+
+void Step::set_iterative_max_iteration(const unsigned& M) {
+    if(iterative_setting.max_iteration != M) {
+        iterative_setting.max_iteration = M;
+        updated = false;
+    }
+}
+
+const IterativeSetting<double>& Step::get_iterative_setting() const { return iterative_setting; }
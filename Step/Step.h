@@ -28,6 +28,7 @@
 #ifndef STEP_H
 #define STEP_H
 
+#include <Domain/MetaMat/IterativeSolver.hpp>
 #include <Domain/Tag.h>
 
 template <typename T> class Factory;
@@ -41,6 +42,9 @@ class Step : public Tag {
 
     bool symm_mat = true;
     bool band_mat = true;
+    bool sparse_mat = false;
+
+    IterativeSetting<double> iterative_setting; /**< linear solver of sparse system */
 
     double time_period = 1.0; /**< time period */
 
@@ -102,8 +106,16 @@ public:
 
     const bool& is_symm() const;
     const bool& is_band() const;
+    const bool& is_sparse() const;
     void set_symm(const bool&);
     void set_band(const bool&);
+    void set_sparse(const bool&);
+
+    void set_iterative_solver(const IterativeSolver&);
+    void set_preconditioner(const PreconditionerType&);
+    void set_iterative_tolerance(const double&);
+    void set_iterative_max_iteration(const unsigned&);
+    const IterativeSetting<double>& get_iterative_setting() const;
 };
 
 #endif
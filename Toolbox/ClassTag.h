@@ -213,5 +213,20 @@
 #ifndef CT_MPDC
 #define CT_MPDC 65
 #endif
+#ifndef CT_BUCKLE
+#define CT_BUCKLE 66
+#endif
+#ifndef CT_HDF
+#define CT_HDF 67
+#endif
+#ifndef CT_EXPLICITDYNAMIC
+#define CT_EXPLICITDYNAMIC 68
+#endif
+#ifndef CT_MODALDYNAMIC
+#define CT_MODALDYNAMIC 69
+#endif
+#ifndef CT_BATCH
+#define CT_BATCH 70
+#endif
 
 #endif
@@ -0,0 +1,237 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Theodore Chang
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "Profiler.h"
+#include <Toolbox/utility.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <typeindex>
+#include <vector>
+
+namespace {
+const char* phase_name[] = { "resistance", "stiffness", "load", "constraint", "factorization", "solve", "update", "convergence", "commit", "record" };
+
+constexpr auto n_phase = sizeof(phase_name) / sizeof(phase_name[0]);
+
+struct ProfileRecord {
+    unsigned long long count = 0;
+    double time = 0.;
+
+    void add(const double T) {
+        ++count;
+        time += T;
+    }
+
+    ProfileRecord& operator+=(const ProfileRecord& R) {
+        count += R.count;
+        time += R.time;
+        return *this;
+    }
+};
+
+struct ProfileTable {
+    std::array<ProfileRecord, n_phase> phase;
+    std::map<std::type_index, ProfileRecord> element, material;
+
+    void merge(const ProfileTable& T) {
+        for(size_t I = 0; I < n_phase; ++I) phase[I] += T.phase[I];
+        for(const auto& I : T.element) element[I.first] += I.second;
+        for(const auto& I : T.material) material[I.first] += I.second;
+    }
+
+    void clear() {
+        phase.fill(ProfileRecord());
+        element.clear();
+        material.clear();
+    }
+};
+
+std::atomic<bool> profile_enabled(false);
+
+string report_file_name;
+
+std::mutex& get_profile_mutex() {
+    static std::mutex profile_mutex;
+    return profile_mutex;
+}
+
+std::set<ProfileTable*>& get_live_table() {
+    static std::set<ProfileTable*> live_table;
+    return live_table;
+}
+
+// records of threads that have already exited
+ProfileTable& get_retired_table() {
+    static ProfileTable retired_table;
+    return retired_table;
+}
+
+struct LocalTable : ProfileTable {
+    LocalTable() {
+        std::lock_guard<std::mutex> t_guard(get_profile_mutex());
+        get_live_table().insert(this);
+    }
+
+    ~LocalTable() {
+        std::lock_guard<std::mutex> t_guard(get_profile_mutex());
+        get_retired_table().merge(*this);
+        get_live_table().erase(this);
+    }
+};
+
+ProfileTable& get_local_table() {
+    thread_local LocalTable local_table;
+    return local_table;
+}
+
+ProfileTable collect() {
+    std::lock_guard<std::mutex> t_guard(get_profile_mutex());
+    auto T = get_retired_table();
+    for(const auto& I : get_live_table()) T.merge(*I);
+    return T;
+}
+
+// GCC gives the mangled name which is prefixed by its length, MSVC prefixes "class "
+string get_type_name(const std::type_index& T) {
+    string name = T.name();
+    if(name.compare(0, 6, "class ") == 0) return name.substr(6);
+    const auto pos = name.find_first_not_of("0123456789");
+    return pos == string::npos ? name : name.substr(pos);
+}
+
+using NamedRecord = std::vector<std::pair<string, ProfileRecord>>;
+
+NamedRecord to_named(const std::map<std::type_index, ProfileRecord>& R) {
+    NamedRecord output;
+    output.reserve(R.size());
+    for(const auto& I : R) output.emplace_back(get_type_name(I.first), I.second);
+    std::sort(output.begin(), output.end(), [](const NamedRecord::value_type& A, const NamedRecord::value_type& B) { return A.second.time > B.second.time; });
+    return output;
+}
+
+void print_group(const char* title, const NamedRecord& R, const double total) {
+    if(R.empty()) return;
+    suanpan_info("%s\n", title);
+    for(const auto& I : R) suanpan_info("\t%-20s %12llu %14.6f %8.2f%%\n", I.first.c_str(), I.second.count, I.second.time, total > 0. ? 1E2 * I.second.time / total : 0.);
+}
+
+void write_json_group(std::ofstream& F, const char* title, const NamedRecord& R, const bool last) {
+    F << "  \"" << title << "\": [";
+    for(size_t I = 0; I < R.size(); ++I) F << (I == 0 ? "\n" : ",\n") << "    {\"name\": \"" << R[I].first << "\", \"count\": " << R[I].second.count << ", \"time\": " << R[I].second.time << "}";
+    F << (R.empty() ? "]" : "\n  ]") << (last ? "\n" : ",\n");
+}
+
+void write_csv_group(std::ofstream& F, const char* title, const NamedRecord& R) {
+    for(const auto& I : R) F << title << "," << I.first << "," << I.second.count << "," << I.second.time << "\n";
+}
+
+NamedRecord get_phase(const ProfileTable& T) {
+    NamedRecord output;
+    output.reserve(n_phase);
+    for(size_t I = 0; I < n_phase; ++I) output.emplace_back(phase_name[I], T.phase[I]);
+    return output;
+}
+}
+
+bool profiler::is_enabled() { return profile_enabled.load(std::memory_order_relaxed); }
+
+void profiler::enable(const bool E) { profile_enabled = E; }
+
+void profiler::clear() {
+    std::lock_guard<std::mutex> t_guard(get_profile_mutex());
+    get_retired_table().clear();
+    for(const auto& I : get_live_table()) I->clear();
+}
+
+void profiler::add(const ProfilePhase& P, const double T) { get_local_table().phase[static_cast<unsigned>(P)].add(T); }
+
+void profiler::add_element(const std::type_info& E, const double T) { get_local_table().element[std::type_index(E)].add(T); }
+
+void profiler::add_material(const std::type_info& M, const double T) { get_local_table().material[std::type_index(M)].add(T); }
+
+void profiler::print() {
+    const auto T = collect();
+
+    auto total = 0.;
+    for(const auto& I : T.phase) total += I.time;
+
+    suanpan_info("\t%-20s %12s %14s %9s\n", "", "count", "time (s)", "share");
+    print_group("analysis phase", get_phase(T), total);
+
+    // shares of types are relative to element state determination
+    const auto& update_time = T.phase[static_cast<unsigned>(ProfilePhase::UPDATE)].time;
+    print_group("element type", to_named(T.element), update_time);
+    print_group("section/material type", to_named(T.material), update_time);
+}
+
+bool profiler::save(const string& file_name) {
+    std::ofstream F(file_name);
+    if(!F.is_open()) {
+        suanpan_error("save() cannot open file %s.\n", file_name.c_str());
+        return false;
+    }
+
+    F.precision(9);
+
+    const auto T = collect();
+    const auto phase = get_phase(T);
+    const auto element = to_named(T.element);
+    const auto material = to_named(T.material);
+
+    if(file_name.size() > 4 && is_equal(file_name.substr(file_name.size() - 4), ".csv")) {
+        F << "category,name,count,time\n";
+        write_csv_group(F, "phase", phase);
+        write_csv_group(F, "element", element);
+        write_csv_group(F, "material", material);
+    } else {
+        F << "{\n";
+        write_json_group(F, "phase", phase, false);
+        write_json_group(F, "element", element, false);
+        write_json_group(F, "material", material, true);
+        F << "}\n";
+    }
+
+    return true;
+}
+
+void profiler::set_report(const string& file_name) { report_file_name = file_name; }
+
+void profiler::report() {
+    if(!report_file_name.empty()) save(report_file_name);
+}
+
+PhaseTimer::PhaseTimer(const ProfilePhase& P) { tic(P); }
+
+PhaseTimer::~PhaseTimer() { toc(); }
+
+void PhaseTimer::tic(const ProfilePhase& P) {
+    toc();
+    phase = P;
+    active = profiler::is_enabled();
+    if(active) timer.tic();
+}
+
+void PhaseTimer::toc() {
+    if(!active) return;
+    profiler::add(phase, timer.toc());
+    active = false;
+}
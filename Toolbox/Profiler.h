@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Copyright (C) 2017 Theodore Chang
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+/**
+ * @fn Profiler
+ * @brief Built-in timers and counters of analysis phases.
+ *
+ * Profiling is off by default and is switched on by the `profile` command.
+ * Each phase of the nonlinear solvers is timed by a `PhaseTimer`. The time
+ * spent in element state determination is further broken down by element
+ * type and by the type of the section (or material if the element does not
+ * use sections) the element refers to.
+ *
+ * Records are kept per thread and merged when a report is generated so that
+ * concurrent domains do not contend on a lock. Reports should be generated
+ * between analyses.
+ *
+ * Example Usage:
+ *
+ * ```cpp
+ *     PhaseTimer T(ProfilePhase::RESISTANCE);
+ *     G->assemble_resistance();
+ *     T.tic(ProfilePhase::STIFFNESS);
+ *     G->assemble_matrix();
+ *     T.toc();
+ * ```
+ *
+ * @author T
+ * @date 19/11/2017
+ * @version 0.1.0
+ * @file Profiler.h
+ * @addtogroup Utility
+ * @{
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <suanPan.h>
+#include <string>
+#include <typeinfo>
+
+using std::string;
+
+enum class ProfilePhase : unsigned { RESISTANCE, STIFFNESS, LOAD, CONSTRAINT, FACTORIZATION, SOLVE, UPDATE, CONVERGENCE, COMMIT, RECORD };
+
+namespace profiler {
+bool is_enabled();
+void enable(const bool);
+void clear();
+
+void add(const ProfilePhase&, const double);
+void add_element(const std::type_info&, const double);
+void add_material(const std::type_info&, const double);
+
+void print();
+bool save(const string&);
+
+void set_report(const string&);
+void report();
+}
+
+/**
+ * \brief A scoped timer that charges the elapsed time to one phase.
+ * Calling `tic()` closes the current phase and starts a new one, the last
+ * phase is closed by `toc()` or on destruction. It does nothing if profiling
+ * is off when the phase starts.
+ */
+class PhaseTimer {
+    ProfilePhase phase = ProfilePhase::RESISTANCE;
+    bool active = false;
+    wall_clock timer;
+
+public:
+    PhaseTimer() = default;
+    explicit PhaseTimer(const ProfilePhase&);
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+    ~PhaseTimer();
+
+    void tic(const ProfilePhase&);
+    void toc();
+};
+
+#endif
+
+//! @}
@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Theodore Chang
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "ThreadPool.h"
+#include <chrono>
+#include <limits>
+#include <suanPan.h>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#ifdef SUANPAN_OPENBLAS
+extern "C" int openblas_get_num_threads();
+extern "C" void openblas_set_num_threads(int);
+#endif
+
+namespace {
+// index of the worker owning the current thread, threads outside the pool have none
+thread_local size_t worker_index = std::numeric_limits<size_t>::max();
+
+bool pin_thread(std::thread& T, const size_t C) {
+#ifdef __linux__
+    cpu_set_t t_set;
+    CPU_ZERO(&t_set);
+    CPU_SET(C % std::max(1u, std::thread::hardware_concurrency()), &t_set);
+    return pthread_setaffinity_np(T.native_handle(), sizeof(cpu_set_t), &t_set) == 0;
+#else
+    return false;
+#endif
+}
+}
+
+ThreadPool::ThreadPool() {
+#ifdef SUANPAN_MT
+    start(std::max(1u, std::thread::hardware_concurrency()));
+#else
+    start(1);
+#endif
+}
+
+void ThreadPool::start(const unsigned N) {
+    stop = false;
+    pending = 0;
+    next_queue = 0;
+
+    // the calling thread counts as one
+    queue.clear();
+    for(unsigned I = 1; I < N; ++I) queue.emplace_back(new TaskQueue);
+
+    worker.reserve(queue.size());
+    for(size_t I = 0; I < queue.size(); ++I) {
+        worker.emplace_back(&ThreadPool::work, this, I);
+        // the calling thread is left on core zero
+        if(affinity && !pin_thread(worker.back(), I + 1)) suanpan_warning("start() cannot pin worker %u.\n", unsigned(I));
+    }
+}
+
+void ThreadPool::shutdown() {
+    {
+        std::lock_guard<std::mutex> t_lock(sleep_lock);
+        stop = true;
+    }
+    wake_up.notify_all();
+    for(auto& I : worker) I.join();
+    worker.clear();
+}
+
+void ThreadPool::work(const size_t I) {
+    worker_index = I;
+
+    std::function<void()> t_task;
+    while(!stop) {
+        if(pop(t_task)) {
+            t_task();
+            continue;
+        }
+        std::unique_lock<std::mutex> t_lock(sleep_lock);
+        wake_up.wait_for(t_lock, std::chrono::milliseconds(10), [&] { return stop || pending != 0; });
+    }
+}
+
+bool ThreadPool::pop(std::function<void()>& T) {
+    const auto n_queue = queue.size();
+    if(n_queue == 0) return false;
+
+    const auto t_own = worker_index < n_queue ? worker_index : 0;
+
+    if(worker_index < n_queue) {
+        auto& t_queue = *queue[t_own];
+        std::lock_guard<std::mutex> t_lock(t_queue.lock);
+        if(!t_queue.task.empty()) {
+            T = std::move(t_queue.task.back());
+            t_queue.task.pop_back();
+            --pending;
+            return true;
+        }
+    }
+
+    for(size_t I = 0; I < n_queue; ++I) {
+        auto& t_queue = *queue[(t_own + I) % n_queue];
+        std::lock_guard<std::mutex> t_lock(t_queue.lock);
+        if(!t_queue.task.empty()) {
+            T = std::move(t_queue.task.front());
+            t_queue.task.pop_front();
+            --pending;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+ThreadPool::~ThreadPool() { shutdown(); }
+
+ThreadPool& ThreadPool::get_pool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+unsigned ThreadPool::size() const { return unsigned(worker.size()) + 1; }
+
+void ThreadPool::resize(const unsigned N) {
+    const auto t_size = std::max(1u, N);
+
+#ifdef SUANPAN_MT
+    shutdown();
+    start(t_size);
+#endif
+
+    set_thread_number(t_size);
+    set_blas_thread(int(t_size));
+}
+
+void ThreadPool::set_affinity(const bool A) {
+#ifndef __linux__
+    if(A) {
+        suanpan_warning("set_affinity() is not supported on this platform.\n");
+        return;
+    }
+#endif
+    if(affinity == A) return;
+    affinity = A;
+    // workers are pinned when started
+    resize(size());
+}
+
+bool ThreadPool::get_affinity() const { return affinity; }
+
+void ThreadPool::submit(TaskGroup& G, std::function<void()>&& F) {
+    ++G.remaining;
+
+    auto t_task = [&G, F = std::move(F)]() {
+        try {
+            F();
+        } catch(...) {
+            std::lock_guard<std::mutex> t_lock(G.error_lock);
+            if(!G.error) G.error = std::current_exception();
+        }
+        --G.remaining;
+    };
+
+    // workers push to their own queues, other threads deal tasks in turn
+    auto& t_queue = *queue[worker_index < queue.size() ? worker_index : next_queue++ % queue.size()];
+
+    // counted before pushed so that the counter never drops below zero
+    {
+        std::lock_guard<std::mutex> t_lock(sleep_lock);
+        ++pending;
+    }
+    {
+        std::lock_guard<std::mutex> t_lock(t_queue.lock);
+        t_queue.task.emplace_back(std::move(t_task));
+    }
+    wake_up.notify_one();
+}
+
+void ThreadPool::wait(TaskGroup& G) {
+    std::function<void()> t_task;
+    while(G.remaining != 0)
+        if(pop(t_task))
+            t_task();
+        else
+            std::this_thread::yield();
+
+    if(G.error) std::rethrow_exception(G.error);
+}
+
+int get_blas_thread() {
+#ifdef SUANPAN_OPENBLAS
+    return openblas_get_num_threads();
+#else
+    return 1;
+#endif
+}
+
+void set_blas_thread(const int N) {
+#ifdef SUANPAN_OPENBLAS
+    openblas_set_num_threads(std::max(1, N));
+#else
+    (void)N;
+#endif
+}
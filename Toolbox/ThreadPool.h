@@ -0,0 +1,194 @@
+/*******************************************************************************
+ * Copyright (C) 2017 Theodore Chang
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+/**
+ * @class ThreadPool
+ * @brief A persistent work-stealing thread pool.
+ *
+ * Each worker owns a task queue. It takes tasks from the back of its own
+ * queue and steals from the front of others when its own queue is empty.
+ * Tasks submitted by threads outside the pool are dealt to the queues in
+ * turn. A thread waiting for a group of tasks keeps executing queued tasks so
+ * nested parallel loops do not deadlock.
+ *
+ * Workers are only started if SUANPAN_MT is defined, otherwise all loops run
+ * in serial. The number of threads (the calling thread included) is set by
+ * resize(), which also sets the default of get_thread_number() and the number
+ * of BLAS threads. Workers can be pinned to cores on Linux.
+ *
+ * `parallel_for()` and `parallel_reduce()` split the range into contiguous
+ * chunks, a few for each thread, so that stealing can balance uneven costs.
+ * Partial results of `parallel_reduce()` are summed in chunk order.
+ *
+ * @author T
+ * @date 21/11/2017
+ * @version 0.1.0
+ * @file ThreadPool.h
+ * @addtogroup Utility
+ * @{
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <Toolbox/utility.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+public:
+    struct TaskGroup {
+        std::atomic<size_t> remaining{ 0 };
+        std::mutex error_lock;
+        std::exception_ptr error = nullptr;
+    };
+
+private:
+    struct TaskQueue {
+        std::mutex lock;
+        std::deque<std::function<void()>> task;
+    };
+
+    std::vector<std::unique_ptr<TaskQueue>> queue;
+    std::vector<std::thread> worker;
+
+    std::atomic<bool> stop{ false };
+    std::atomic<size_t> pending{ 0 };
+    std::atomic<size_t> next_queue{ 0 };
+
+    std::mutex sleep_lock;
+    std::condition_variable wake_up;
+
+    bool affinity = false;
+
+    ThreadPool();
+
+    void start(const unsigned);
+    void shutdown();
+
+    void work(const size_t);
+
+    bool pop(std::function<void()>&);
+
+public:
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ~ThreadPool();
+
+    static ThreadPool& get_pool();
+
+    unsigned size() const;
+    void resize(const unsigned);
+
+    void set_affinity(const bool);
+    bool get_affinity() const;
+
+    void submit(TaskGroup&, std::function<void()>&&);
+    void wait(TaskGroup&);
+};
+
+int get_blas_thread();
+void set_blas_thread(const int);
+
+/**
+ * \brief Calls `F(I)` for all `I` in `[0, N)`.
+ */
+template <typename F> void parallel_for(const size_t N, F&& func) {
+    auto& t_pool = ThreadPool::get_pool();
+
+    const auto n_thread = std::min(size_t(get_thread_number()), size_t(t_pool.size()));
+    if(n_thread < 2 || N < 2) {
+        for(size_t I = 0; I < N; ++I) func(I);
+        return;
+    }
+
+    const auto n_chunk = std::min(N, 4 * n_thread);
+    const auto t_task = [&](const size_t C) {
+        const auto t_end = (C + 1) * N / n_chunk;
+        for(auto I = C * N / n_chunk; I < t_end; ++I) func(I);
+    };
+
+    ThreadPool::TaskGroup t_group;
+    for(size_t C = 1; C < n_chunk; ++C) t_pool.submit(t_group, [&t_task, C] { t_task(C); });
+
+    // the submitted chunks refer to this frame, wait for them before throwing
+    std::exception_ptr t_error = nullptr;
+    try {
+        t_task(0);
+    } catch(...) {
+        t_error = std::current_exception();
+    }
+    t_pool.wait(t_group);
+    if(t_error) std::rethrow_exception(t_error);
+}
+
+/**
+ * \brief Calls `F(I)` for all `I` in `[0, N)` and sums the returned codes.
+ */
+template <typename F> int parallel_reduce(const size_t N, F&& func) {
+    const auto n_chunk = std::min(N, 4 * size_t(get_thread_number()));
+
+    std::vector<int> t_code(n_chunk, 0);
+    parallel_for(n_chunk, [&](const size_t C) {
+        const auto t_end = (C + 1) * N / n_chunk;
+        auto t_sum = 0;
+        for(auto I = C * N / n_chunk; I < t_end; ++I) t_sum += func(I);
+        t_code[C] = t_sum;
+    });
+
+    auto code = 0;
+    for(const auto& I : t_code) code += I;
+    return code;
+}
+
+/**
+ * \brief Runs two tasks concurrently.
+ */
+template <typename FA, typename FB> void parallel_invoke(FA&& func_a, FB&& func_b) {
+    parallel_for(2, [&](const size_t I) {
+        if(I == 0)
+            func_a();
+        else
+            func_b();
+    });
+}
+
+template <typename IT, typename F> void suanpan_for_each(const IT first, const IT last, F&& func, std::random_access_iterator_tag) {
+    parallel_for(size_t(last - first), [&](const size_t I) { func(*(first + I)); });
+}
+
+template <typename IT, typename F> void suanpan_for_each(IT first, const IT last, F&& func, std::forward_iterator_tag) {
+    std::vector<IT> t_iterator;
+    for(; first != last; ++first) t_iterator.emplace_back(first);
+    parallel_for(t_iterator.size(), [&](const size_t I) { func(*t_iterator[I]); });
+}
+
+/**
+ * \brief A parallel `std::for_each`. Containers without random access are
+ * indexed through a temporary list of iterators.
+ */
+template <typename IT, typename F> void suanpan_for_each(const IT first, const IT last, F&& func) { suanpan_for_each(first, last, std::forward<F>(func), typename std::iterator_traits<IT>::iterator_category()); }
+
+#endif
+
+//! @}
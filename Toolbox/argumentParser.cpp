@@ -16,8 +16,10 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "argumentParser.h"
+#include "binaryParser.h"
 #include "commandParser.h"
 #include <Step/Bead.h>
+#include <Toolbox/ThreadPool.h>
 #include <Toolbox/utility.h>
 #include <suanPan.h>
 #include <time.h>
@@ -28,6 +30,10 @@ using std::string;
 void argument_parser(const int argc, char** argv) {
     string input_file_name = "";
     string output_file_name = "";
+    string convert_input_name = "";
+    string convert_output_name = "";
+    unsigned thread_number = 0;
+    auto thread_affinity = false;
     ofstream output_file;
     const auto buffer_backup = cout.rdbuf();
 
@@ -43,6 +49,22 @@ void argument_parser(const int argc, char** argv) {
                 input_file_name = argv[++i];
             else if(is_equal(argv[i], "-o") || is_equal(argv[i], "--output"))
                 output_file_name = argv[++i];
+            else if((is_equal(argv[i], "-c") || is_equal(argv[i], "--convert")) && i + 2 < argc) {
+                convert_input_name = argv[++i];
+                convert_output_name = argv[++i];
+            }
+            else if(is_equal(argv[i], "-t") || is_equal(argv[i], "--thread"))
+                thread_number = unsigned(std::max(0, atoi(argv[++i])));
+            else if(is_equal(argv[i], "-a") || is_equal(argv[i], "--affinity"))
+                thread_affinity = true;
+        }
+
+        if(thread_number != 0) ThreadPool::get_pool().resize(thread_number);
+        if(thread_affinity) ThreadPool::get_pool().set_affinity(true);
+
+        if(convert_input_name != "") {
+            convert_file(convert_input_name.c_str(), convert_output_name.c_str());
+            return;
         }
 
         if(output_file_name != "") {
@@ -93,7 +115,10 @@ void print_helper() {
     suanpan_info("\t-v,  --version\t\tcheck version information\n");
     suanpan_info("\t-h,  --help\t\tprint this helper\n");
     suanpan_info("\t-f,  --file\t\tprocess model file\n");
-    suanpan_info("\t-o,  --output\t\tset output file for logging\n\n");
+    suanpan_info("\t-o,  --output\t\tset output file for logging\n");
+    suanpan_info("\t-c,  --convert\t\tconvert text model file to binary model file\n");
+    suanpan_info("\t-t,  --thread\t\tset number of threads\n");
+    suanpan_info("\t-a,  --affinity\t\tpin worker threads to cores\n\n");
 }
 
 void cli_mode(const shared_ptr<Bead>& model) {
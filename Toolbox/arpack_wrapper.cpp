@@ -16,8 +16,14 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "arpack_wrapper.h"
+#include <mutex>
+
+// ARPACK keeps its state in SAVE variables, concurrent calls from different domains are serialized
+static std::mutex arpack_mutex;
 
 int eig_solve(cx_vec& eigval, cx_mat& eigvec, mat& K, const unsigned& num, const char* form) {
+    std::lock_guard<std::mutex> t_guard(arpack_mutex);
+
     auto IDO = 0;
     auto BMAT = 'I'; // standard eigenvalue problem A*x=lambda*x
     auto N = static_cast<int>(K.n_rows);
@@ -80,6 +86,8 @@ int eig_solve(cx_vec& eigval, cx_mat& eigvec, mat& K, const unsigned& num, const
 }
 
 int eig_solve(cx_vec& eigval, cx_mat& eigvec, mat& K, mat& M, const unsigned& num, const char* form) {
+    std::lock_guard<std::mutex> t_guard(arpack_mutex);
+
     auto IDO = 0;
     auto BMAT = 'G'; // generalized eigenvalue problem A*x=lambda*B*x
     auto N = static_cast<int>(K.n_rows);
@@ -144,6 +152,8 @@ int eig_solve(cx_vec& eigval, cx_mat& eigvec, mat& K, mat& M, const unsigned& nu
 }
 
 int eig_solve(vec& eigval, mat& eigvec, mat& K, const unsigned& num, const char* form) {
+    std::lock_guard<std::mutex> t_guard(arpack_mutex);
+
     auto IDO = 0;
     auto BMAT = 'I'; // standard eigenvalue problem A*x=lambda*x
     auto N = static_cast<int>(K.n_rows);
@@ -190,6 +200,8 @@ int eig_solve(vec& eigval, mat& eigvec, mat& K, const unsigned& num, const char*
 }
 
 int eig_solve(vec& eigval, mat& eigvec, mat& K, mat& M, const unsigned& num, const char* form) {
+    std::lock_guard<std::mutex> t_guard(arpack_mutex);
+
     auto IDO = 0;
     auto BMAT = 'G'; // generalized eigenvalue problem A*x=lambda*M*x
     auto N = static_cast<int>(K.n_rows);
@@ -236,3 +248,160 @@ int eig_solve(vec& eigval, mat& eigvec, mat& K, mat& M, const unsigned& num, con
 
     return INFO;
 }
+
+/**
+ * \brief Solves K*x=lambda*M*x for eigenvalues closest to the shift.
+ * The operator inv(K-sigma*M)*M is applied through the factorization of K,
+ * which is computed by the first solve() and reused by all later solve_trs().
+ * K is modified in place, M is only used in matrix--vector products.
+ */
+int eig_solve(vec& eigval, mat& eigvec, const shared_ptr<MetaMat<double>>& K, const shared_ptr<MetaMat<double>>& M, const unsigned& num, const double& shift) {
+    std::lock_guard<std::mutex> t_guard(arpack_mutex);
+
+    auto IDO = 0;
+    auto BMAT = 'G'; // generalized eigenvalue problem A*x=lambda*M*x
+    auto N = static_cast<int>(K->n_cols);
+    char WHICH[2] = { 'L', 'M' };
+    auto NEV = std::min(static_cast<int>(num), N - 1);
+    auto TOL = 0.;
+    auto NCV = std::min(std::max(2 * NEV + 1, 20), N);
+    auto LDV = N;
+    auto LWORKL = NCV * (NCV + 8);
+    auto INFO = 0;
+
+    podarray<int> IPARAM(11), IPNTR(14);
+    podarray<double> RESID(N), V(N * NCV), WORKD(3 * N), WORKL(LWORKL);
+
+    IPARAM(0) = 1;    // exact shift
+    IPARAM(2) = 1000; // maximum iteration
+    IPARAM(6) = 3;    // mode 3: shift-invert
+
+    if(shift != 0.) *K -= shift * *M;
+
+    vec T(N);
+    while(IDO != 99) {
+        arma_fortran(arma_dsaupd)(&IDO, &BMAT, &N, WHICH, &NEV, &TOL, RESID.memptr(), &NCV, V.memptr(), &LDV, IPARAM.memptr(), IPNTR.memptr(), WORKD.memptr(), WORKL.memptr(), &LWORKL, &INFO);
+        const vec X(WORKD.memptr() + IPNTR[0] - 1, N, false, true);
+        vec Y(WORKD.memptr() + IPNTR[1] - 1, N, false, true);
+        if(IDO == -1 || IDO == 1) {
+            // M*X is available in the third segment except for the initial call
+            const auto code = IDO == 1 ? K->solve_trs(T, vec(WORKD.memptr() + IPNTR[2] - 1, N, false, true)) : K->factored ? K->solve_trs(T, *M * X) : K->solve(T, *M * X);
+            if(code != 0) return code;
+            Y = T;
+        } else if(IDO == 2)
+            Y = *M * X;
+    }
+
+    if(INFO != 0) {
+        suanpan_error("eig_solve() receives error code %d from dsaupd.\n", INFO);
+        return INFO;
+    }
+
+    auto RVEC = 1;
+    auto HOWMNY = 'A';
+    auto LDZ = N;
+    auto SIGMA = shift;
+
+    podarray<int> SELECT(NCV);
+
+    eigval.set_size(NEV);
+    eigvec.set_size(N, NEV);
+
+    arma_fortran(arma_dseupd)(&RVEC, &HOWMNY, SELECT.memptr(), eigval.memptr(), eigvec.memptr(), &LDZ, &SIGMA, &BMAT, &N, WHICH, &NEV, &TOL, RESID.memptr(), &NCV, V.memptr(), &LDV, IPARAM.memptr(), IPNTR.memptr(), WORKD.memptr(), WORKL.memptr(), &LWORKL, &INFO);
+
+    if(INFO != 0) suanpan_error("eig_solve() receives error code %d from dseupd.\n", INFO);
+
+    return INFO;
+}
+
+/**
+ * \brief Solves (K+lambda*G)*x=0 for the smallest positive load factors.
+ * The problem is transformed into -inv(K)*G*x=x/lambda so that the lowest
+ * critical factors are the dominant Ritz values. Only the factorization of K
+ * is needed, K can be passed in already factorized form.
+ */
+int buckle_solve(vec& eigval, mat& eigvec, const shared_ptr<MetaMat<double>>& K, const shared_ptr<MetaMat<double>>& G, const unsigned& num) {
+    std::lock_guard<std::mutex> t_guard(arpack_mutex);
+
+    auto IDO = 0;
+    auto BMAT = 'I'; // standard eigenvalue problem A*x=lambda*x
+    auto N = static_cast<int>(K->n_cols);
+    char WHICH[2] = { 'L', 'R' };
+    auto NEV = std::min(static_cast<int>(num), N - 2);
+    auto TOL = 0.;
+    auto NCV = std::min(std::max(2 * NEV + 1, 20), N);
+    auto LDV = N;
+    auto LWORKL = 3 * NCV * (NCV + 2);
+    auto INFO = 0;
+
+    podarray<int> IPARAM(11), IPNTR(14);
+    podarray<double> RESID(N), V(N * NCV), WORKD(3 * N), WORKL(LWORKL);
+
+    IPARAM(0) = 1;    // exact shift
+    IPARAM(2) = 1000; // maximum iteration
+    IPARAM(6) = 1;    // mode 1: A*x=lambda*x
+
+    vec T(N);
+    while(IDO != 99) {
+        arma_fortran(arma_dnaupd)(&IDO, &BMAT, &N, WHICH, &NEV, &TOL, RESID.memptr(), &NCV, V.memptr(), &LDV, IPARAM.memptr(), IPNTR.memptr(), WORKD.memptr(), WORKL.memptr(), &LWORKL, &INFO);
+        if(IDO == 1 || IDO == -1) {
+            const vec X(WORKD.memptr() + IPNTR[0] - 1, N, false, true);
+            vec Y(WORKD.memptr() + IPNTR[1] - 1, N, false, true);
+            const auto code = K->factored ? K->solve_trs(T, -(*G * X)) : K->solve(T, -(*G * X));
+            if(code != 0) return code;
+            Y = T;
+        }
+    }
+
+    if(INFO != 0) {
+        suanpan_error("buckle_solve() receives error code %d from dnaupd.\n", INFO);
+        return INFO;
+    }
+
+    auto RVEC = 1;
+    auto HOWMNY = 'A';
+    auto LDZ = N;
+    auto SIGMAR = 0.;
+    auto SIGMAI = 0.;
+
+    podarray<int> SELECT(NCV);
+    podarray<double> DR(NEV + 1), DI(NEV + 1), Z(N * (NEV + 1)), WORKEV(3 * NCV);
+
+    arma_fortran(arma_dneupd)(&RVEC, &HOWMNY, SELECT.memptr(), DR.memptr(), DI.memptr(), Z.memptr(), &LDZ, &SIGMAR, &SIGMAI, WORKEV.memptr(), &BMAT, &N, WHICH, &NEV, &TOL, RESID.memptr(), &NCV, V.memptr(), &LDV, IPARAM.memptr(), IPNTR.memptr(), WORKD.memptr(), WORKL.memptr(), &LWORKL, &INFO);
+
+    if(INFO != 0) {
+        suanpan_error("buckle_solve() receives error code %d from dneupd.\n", INFO);
+        return INFO;
+    }
+
+    // the problem is real symmetric in nature, imaginary parts are discarded
+    // larger Ritz values correspond to smaller positive load factors
+    const vec t_ritz(DR.memptr(), IPARAM(4));
+    const uvec t_idx = sort_index(t_ritz, "descend");
+
+    // vanishing Ritz values are modes that G does not excite, they have no finite load factor
+    const auto t_tolerance = t_ritz.is_empty() ? 0. : 1E-12 * max(abs(t_ritz));
+
+    eigval.set_size(t_idx.n_elem);
+    eigvec.set_size(N, t_idx.n_elem);
+
+    uword t_count = 0;
+    for(const auto& I : t_idx) {
+        if(std::abs(t_ritz(I)) <= t_tolerance) continue;
+        eigval(t_count) = 1. / t_ritz(I);
+        eigvec.col(t_count++) = vec(Z.memptr() + N * I, N);
+    }
+
+    if(t_count < t_idx.n_elem) {
+        suanpan_warning("buckle_solve() skips %u mode(s) with vanishing Ritz value.\n", unsigned(t_idx.n_elem - t_count));
+        eigval.resize(t_count);
+        eigvec.resize(N, t_count);
+    }
+
+    if(t_count == 0) {
+        suanpan_error("buckle_solve() finds no mode with a finite load factor.\n");
+        return -1;
+    }
+
+    return INFO;
+}
@@ -18,7 +18,7 @@
 #ifndef ARPACK_WRAPPER_H
 #define ARPACK_WRAPPER_H
 
-#include <armadillo>
+#include <Domain/MetaMat/MetaMat>
 
 using namespace arma;
 
@@ -28,4 +28,10 @@ int eig_solve(cx_vec&, cx_mat&, mat&, mat&, const unsigned&, const char* = "SM")
 int eig_solve(vec&, mat&, mat&, const unsigned&, const char* = "SM");
 int eig_solve(vec&, mat&, mat&, mat&, const unsigned&, const char* = "SM");
 
+// SYMMETRIC MATRIX IN SHIFT-INVERT MODE
+int eig_solve(vec&, mat&, const shared_ptr<MetaMat<double>>&, const shared_ptr<MetaMat<double>>&, const unsigned&, const double& = 0.);
+
+// LINEAR BUCKLING (K+lambda*G)*x=0
+int buckle_solve(vec&, mat&, const shared_ptr<MetaMat<double>>&, const shared_ptr<MetaMat<double>>&, const unsigned&);
+
 #endif
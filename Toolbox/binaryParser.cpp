@@ -0,0 +1,361 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Theodore Chang
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "binaryParser.h"
+#include <Domain/DomainBase.h>
+#include <Domain/Node.h>
+#include <Element/ElementParser.h>
+#include <Step/Bead.h>
+#include <Toolbox/ThreadPool.h>
+#include <Toolbox/commandParser.h>
+#include <Toolbox/utility.h>
+#include <fstream>
+#include <limits>
+#include <map>
+
+using std::ifstream;
+using std::map;
+using std::vector;
+
+#ifndef SUANPAN_NO_HDF5
+#include <hdf5.h>
+#include <hdf5_hl.h>
+
+namespace {
+struct ElementTable {
+    vector<unsigned> size;
+    vector<double> data;
+};
+
+struct ModelBlock {
+    vector<unsigned> node_tag, node_size;
+    vector<double> node_coordinate;
+    map<string, ElementTable> element;
+    string command;
+
+    bool has_geometry() const { return !node_tag.empty() || !element.empty(); }
+};
+
+bool get_number(const string& T, double& V) {
+    char* t_end;
+    V = strtod(T.c_str(), &t_end);
+    return t_end != T.c_str() && *t_end == '\0';
+}
+
+// all remaining tokens must be numbers, otherwise the line is kept as text
+bool get_numbers(istringstream& I, vector<double>& V) {
+    V.clear();
+    string t_token;
+    double t_value;
+    while(get_input(I, t_token)) {
+        if(!get_number(t_token, t_value)) return false;
+        V.push_back(t_value);
+    }
+    return true;
+}
+
+bool is_tag(const double T) { return T >= 0. && T <= double(std::numeric_limits<unsigned>::max()) && T == floor(T); }
+
+// one line per command in the same format as the text file
+string get_arguments(const double* D, const unsigned N) {
+    // no trailing space, parsers check eof() for optional arguments
+    string t_line;
+    t_line.reserve(8 * N);
+    char t_buffer[32];
+    for(unsigned I = 0; I < N; ++I) {
+        if(I != 0) t_line += ' ';
+        // most arguments are tags, integers are much cheaper to format
+        if(std::abs(D[I]) < 1E15 && D[I] == floor(D[I]))
+            t_line += std::to_string(static_cast<long long>(D[I]));
+        else {
+            snprintf(t_buffer, sizeof(t_buffer), "%.17g", D[I]);
+            t_line += t_buffer;
+        }
+    }
+    return t_line;
+}
+
+int process_text(const shared_ptr<Bead>& model, const string& T) {
+    istringstream t_text(T);
+    string command_line;
+    while(!getline(t_text, command_line).fail())
+        if(!command_line.empty()) {
+            istringstream tmp_str(command_line);
+            if(process_command(model, tmp_str) == SUANPAN_EXIT) return SUANPAN_EXIT;
+        }
+    return 0;
+}
+
+void create_node(const shared_ptr<DomainBase>& D, const ModelBlock& B) {
+    const auto t_size = B.node_tag.size();
+    if(t_size == 0) return;
+
+    vector<size_t> t_offset(t_size + 1, 0);
+    for(size_t I = 0; I < t_size; ++I) t_offset[I + 1] = t_offset[I] + B.node_size[I];
+
+    vector<shared_ptr<Node>> t_node(t_size);
+    parallel_for(t_size, [&](const size_t I) { t_node[I] = make_shared<Node>(B.node_tag[I], vec(B.node_coordinate.data() + t_offset[I], B.node_size[I])); });
+
+    D->insert(t_node);
+}
+
+void create_element(const shared_ptr<DomainBase>& D, const string& T, const ElementTable& E) {
+    const auto t_size = E.size.size();
+
+    vector<size_t> t_offset(t_size + 1, 0);
+    for(size_t I = 0; I < t_size; ++I) t_offset[I + 1] = t_offset[I] + E.size[I];
+
+    vector<string> t_argument(t_size);
+    parallel_for(t_size, [&](const size_t I) { t_argument[I] = get_arguments(E.data.data() + t_offset[I], E.size[I]); });
+
+    create_element_batch(D, T, t_argument);
+}
+
+void write_data(const hid_t G, const char* N, const vector<unsigned>& D) {
+    const hsize_t t_size = D.size();
+    H5LTmake_dataset(G, N, 1, &t_size, H5T_NATIVE_UINT, D.data());
+}
+
+void write_data(const hid_t G, const char* N, const vector<double>& D) {
+    const hsize_t t_size = D.size();
+    H5LTmake_dataset(G, N, 1, &t_size, H5T_NATIVE_DOUBLE, D.data());
+}
+
+void write_data(const hid_t G, const char* N, const string& D) {
+    const hsize_t t_size = D.size();
+    H5LTmake_dataset_char(G, N, 1, &t_size, D.data());
+}
+
+bool read_data(const hid_t G, const char* N, vector<unsigned>& D) {
+    hsize_t t_size = 0;
+    if(H5LTget_dataset_info(G, N, &t_size, nullptr, nullptr) < 0) return false;
+    D.resize(t_size);
+    return t_size == 0 || H5LTread_dataset(G, N, H5T_NATIVE_UINT, D.data()) >= 0;
+}
+
+bool read_data(const hid_t G, const char* N, vector<double>& D) {
+    hsize_t t_size = 0;
+    if(H5LTget_dataset_info(G, N, &t_size, nullptr, nullptr) < 0) return false;
+    D.resize(t_size);
+    return t_size == 0 || H5LTread_dataset(G, N, H5T_NATIVE_DOUBLE, D.data()) >= 0;
+}
+
+bool read_data(const hid_t G, const char* N, string& D) {
+    hsize_t t_size = 0;
+    if(H5LTget_dataset_info(G, N, &t_size, nullptr, nullptr) < 0) return false;
+    D.resize(t_size);
+    return t_size == 0 || H5LTread_dataset_char(G, N, &D[0]) >= 0;
+}
+
+herr_t collect_name(hid_t, const char* N, const H5L_info_t*, void* D) {
+    static_cast<vector<string>*>(D)->emplace_back(N);
+    return 0;
+}
+
+string get_block_name(const size_t K) { return "block_" + std::to_string(K); }
+
+bool write_block(const hid_t F, const size_t K, const ModelBlock& B) {
+    const auto t_block = H5Gcreate(F, get_block_name(K).c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    if(t_block < 0) return false;
+
+    if(!B.node_tag.empty()) {
+        const auto t_group = H5Gcreate(t_block, "node", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        write_data(t_group, "tag", B.node_tag);
+        write_data(t_group, "size", B.node_size);
+        write_data(t_group, "coordinate", B.node_coordinate);
+        H5Gclose(t_group);
+    }
+
+    if(!B.element.empty()) {
+        const auto t_group = H5Gcreate(t_block, "element", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+        for(const auto& I : B.element) {
+            const auto t_type = H5Gcreate(t_group, I.first.c_str(), H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+            write_data(t_type, "size", I.second.size);
+            write_data(t_type, "data", I.second.data);
+            H5Gclose(t_type);
+        }
+        H5Gclose(t_group);
+    }
+
+    if(!B.command.empty()) write_data(t_block, "command", B.command);
+
+    H5Gclose(t_block);
+
+    return true;
+}
+
+bool read_block(const hid_t F, const size_t K, ModelBlock& B) {
+    const auto t_block = H5Gopen(F, get_block_name(K).c_str(), H5P_DEFAULT);
+    if(t_block < 0) return false;
+
+    auto flag = true;
+
+    if(H5Lexists(t_block, "node", H5P_DEFAULT) > 0) {
+        const auto t_group = H5Gopen(t_block, "node", H5P_DEFAULT);
+        flag &= read_data(t_group, "tag", B.node_tag) && read_data(t_group, "size", B.node_size) && read_data(t_group, "coordinate", B.node_coordinate);
+        flag &= B.node_tag.size() == B.node_size.size();
+        H5Gclose(t_group);
+    }
+
+    if(H5Lexists(t_block, "element", H5P_DEFAULT) > 0) {
+        const auto t_group = H5Gopen(t_block, "element", H5P_DEFAULT);
+        vector<string> t_type;
+        H5Literate(t_group, H5_INDEX_NAME, H5_ITER_NATIVE, nullptr, collect_name, &t_type);
+        for(const auto& I : t_type) {
+            const auto t_table = H5Gopen(t_group, I.c_str(), H5P_DEFAULT);
+            auto& t_element = B.element[I];
+            flag &= read_data(t_table, "size", t_element.size) && read_data(t_table, "data", t_element.data);
+            H5Gclose(t_table);
+        }
+        H5Gclose(t_group);
+    }
+
+    if(H5Lexists(t_block, "command", H5P_DEFAULT) > 0) flag &= read_data(t_block, "command", B.command);
+
+    H5Gclose(t_block);
+
+    return flag;
+}
+}
+#endif
+
+bool is_binary_file(const string& file_name) { return file_name.size() > 3 && is_equal(file_name.substr(file_name.size() - 3), ".h5"); }
+
+int convert_file(const char* input_name, const char* output_name) {
+#ifdef SUANPAN_NO_HDF5
+    suanpan_error("convert_file() requires HDF5 support.\n");
+    return -1;
+#else
+    ifstream input_file(input_name);
+    if(!input_file.is_open()) {
+        suanpan_error("convert_file() cannot open file %s.\n", input_name);
+        return -1;
+    }
+
+    vector<ModelBlock> t_block(1);
+
+    string command_line, command_id, element_id;
+    vector<double> t_number;
+    while(!getline(input_file, command_line).fail()) {
+        if(command_line.empty() || command_line[0] == '#') continue;
+
+        istringstream tmp_str(command_line);
+        if(!get_input(tmp_str, command_id)) continue;
+
+        auto t_geometry = false;
+        if(is_equal(command_id, "node"))
+            t_geometry = get_numbers(tmp_str, t_number) && !t_number.empty() && is_tag(t_number[0]);
+        else if(is_equal(command_id, "element"))
+            t_geometry = get_input(tmp_str, element_id) && get_numbers(tmp_str, t_number) && !t_number.empty();
+
+        if(!t_geometry) {
+            t_block.back().command += command_line + '\n';
+            continue;
+        }
+
+        // geometry after commands starts a new block to keep the order
+        if(!t_block.back().command.empty()) t_block.emplace_back();
+
+        auto& t_current = t_block.back();
+        if(is_equal(command_id, "node")) {
+            t_current.node_tag.push_back(unsigned(t_number[0]));
+            t_current.node_size.push_back(unsigned(t_number.size() - 1));
+            t_current.node_coordinate.insert(t_current.node_coordinate.end(), t_number.cbegin() + 1, t_number.cend());
+        } else {
+            auto& t_table = t_current.element[element_id];
+            t_table.size.push_back(unsigned(t_number.size()));
+            t_table.data.insert(t_table.data.end(), t_number.cbegin(), t_number.cend());
+        }
+    }
+
+    std::lock_guard<std::mutex> t_guard(get_hdf5_mutex());
+
+    const auto t_file = H5Fcreate(output_name, H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    if(t_file < 0) {
+        suanpan_error("convert_file() cannot create file %s.\n", output_name);
+        return -1;
+    }
+
+    auto code = 0;
+    for(size_t I = 0; I < t_block.size(); ++I)
+        if(!write_block(t_file, I, t_block[I])) {
+            suanpan_error("convert_file() cannot write block %u.\n", unsigned(I));
+            code = -1;
+            break;
+        }
+
+    H5Fclose(t_file);
+
+    return code;
+#endif
+}
+
+int convert_file(istringstream& command) {
+    string input_name, output_name;
+    if(!get_input(command, input_name) || !get_input(command, output_name)) {
+        suanpan_info("convert_file() needs an input file name and an output file name.\n");
+        return 0;
+    }
+
+    if(convert_file(input_name.c_str(), output_name.c_str()) == 0) suanpan_info("convert_file() writes model to %s.\n", output_name.c_str());
+
+    return 0;
+}
+
+int process_binary_file(const shared_ptr<Bead>& model, const char* file_name) {
+#ifdef SUANPAN_NO_HDF5
+    suanpan_error("process_binary_file() requires HDF5 support.\n");
+    return 0;
+#else
+    hid_t t_file;
+    {
+        std::lock_guard<std::mutex> t_guard(get_hdf5_mutex());
+        t_file = H5Fopen(file_name, H5F_ACC_RDONLY, H5P_DEFAULT);
+    }
+    if(t_file < 0) {
+        suanpan_error("process_binary_file() cannot open file %s.\n", file_name);
+        return 0;
+    }
+
+    auto code = 0;
+    for(size_t K = 0;; ++K) {
+        ModelBlock t_block;
+        {
+            // commands in the block may write to HDF5 files, the lock is only held while reading
+            std::lock_guard<std::mutex> t_guard(get_hdf5_mutex());
+            if(H5Lexists(t_file, get_block_name(K).c_str(), H5P_DEFAULT) <= 0) break;
+            if(!read_block(t_file, K, t_block)) {
+                suanpan_error("process_binary_file() cannot read block %u.\n", unsigned(K));
+                break;
+            }
+        }
+
+        if(t_block.has_geometry()) {
+            const auto& t_domain = get_current_domain(model);
+            create_node(t_domain, t_block);
+            for(const auto& I : t_block.element) create_element(t_domain, I.first, I.second);
+        }
+
+        if((code = process_text(model, t_block.command)) == SUANPAN_EXIT) break;
+    }
+
+    std::lock_guard<std::mutex> t_guard(get_hdf5_mutex());
+    H5Fclose(t_file);
+
+    return code;
+#endif
+}
@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (C) 2017 Theodore Chang
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+/**
+ * @fn binaryParser
+ * @brief Binary model files stored in HDF5 format.
+ *
+ * A text model is converted by the `convert` command. Nodes and elements are
+ * stored as numeric arrays, all other commands are kept as text and replayed
+ * by process_command(). To keep the order of commands, the model is split
+ * into blocks, each block holds some nodes and elements followed by some
+ * commands. The layout is
+ *
+ * ```
+ *     /block_K/node/tag                   node tags
+ *     /block_K/node/size                  number of coordinates of each node
+ *     /block_K/node/coordinate            all coordinates
+ *     /block_K/element/$type/size         number of arguments of each element
+ *     /block_K/element/$type/data         all arguments following the type
+ *     /block_K/command                    other commands separated by '\n'
+ * ```
+ *
+ * Files ending with `.h5` are loaded by process_file(). Nodes and elements of
+ * built-in types are created concurrently and inserted into the domain in
+ * batches so that large models do not go through the command dispatcher one
+ * line at a time.
+ *
+ * @author T
+ * @date 21/11/2017
+ * @version 0.1.0
+ * @file binaryParser.h
+ * @addtogroup Utility
+ * @{
+ */
+
+#ifndef BINARYPARSER_H
+#define BINARYPARSER_H
+
+#include <suanPan.h>
+
+class Bead;
+
+bool is_binary_file(const string&);
+
+int convert_file(const char*, const char*);
+int convert_file(istringstream&);
+
+int process_binary_file(const shared_ptr<Bead>&, const char*);
+
+#endif
+
+//! @}
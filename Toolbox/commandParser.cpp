@@ -31,8 +31,10 @@ int process_command(const shared_ptr<Bead>& model, istringstream& command) {
     if(is_equal(command_id, "quit")) return SUANPAN_EXIT;
 
     if(is_equal(command_id, "file")) return process_file(model, command);
+    if(is_equal(command_id, "convert")) return convert_file(command);
 
     if(is_equal(command_id, "domain")) return create_new_domain(model, command);
+    if(is_equal(command_id, "ensemble")) return create_ensemble(model, command);
 
     if(is_equal(command_id, "enable")) return enable_object(model, command);
     if(is_equal(command_id, "disable")) return disable_object(model, command);
@@ -42,6 +44,8 @@ int process_command(const shared_ptr<Bead>& model, istringstream& command) {
     if(is_equal(command_id, "remove")) return erase_object(model, command);
     if(is_equal(command_id, "save")) return save_object(model, command);
 
+    if(is_equal(command_id, "profile")) return set_profile(command);
+
     const auto& domain = get_current_domain(model);
 
     if(is_equal(command_id, "acceleration")) return create_new_acceleration(domain, command);
@@ -53,12 +57,16 @@ int process_command(const shared_ptr<Bead>& model, istringstream& command) {
     if(is_equal(command_id, "displacement")) return create_new_displacement(domain, command);
     if(is_equal(command_id, "dispload")) return create_new_displacement(domain, command);
     if(is_equal(command_id, "element")) return create_new_element(domain, command);
+    if(is_equal(command_id, "elementgrid")) return create_element_grid(domain, command);
     if(is_equal(command_id, "fix")) return create_new_bc(domain, command);
     if(is_equal(command_id, "import")) return create_new_external_module(domain, command);
     if(is_equal(command_id, "integrator")) return create_new_integrator(domain, command);
     if(is_equal(command_id, "material")) return create_new_material(domain, command);
     if(is_equal(command_id, "mass")) return create_new_mass(domain, command);
     if(is_equal(command_id, "node")) return create_new_node(domain, command);
+    if(is_equal(command_id, "nodecopy")) return copy_node(domain, command);
+    if(is_equal(command_id, "nodegrid")) return create_node_grid(domain, command);
+    if(is_equal(command_id, "nodemirror")) return mirror_node(domain, command);
     if(is_equal(command_id, "recorder")) return create_new_recorder(domain, command);
     if(is_equal(command_id, "section")) return create_new_section(domain, command);
     if(is_equal(command_id, "solver")) return create_new_solver(domain, command);
@@ -66,6 +74,9 @@ int process_command(const shared_ptr<Bead>& model, istringstream& command) {
 
     if(is_equal(command_id, "set")) return set_property(domain, command);
 
+    if(is_equal(command_id, "checkpoint")) return set_checkpoint(domain, command);
+    if(is_equal(command_id, "restart")) return set_restart(domain, command);
+
     if(is_equal(command_id, "materialtest")) return test_material(domain, command);
 
     if(is_equal(command_id, "peek")) return print_info(domain, command);
@@ -91,6 +102,8 @@ int process_command(const shared_ptr<Bead>& model, istringstream& command) {
 }
 
 int process_file(const shared_ptr<Bead>& model, const char* file_name) {
+    if(is_binary_file(file_name)) return process_binary_file(model, file_name);
+
     ifstream input_file(file_name);
 
     if(!input_file.is_open()) {
@@ -143,6 +156,96 @@ int create_new_domain(const shared_ptr<Bead>& model, istringstream& command) {
     return 0;
 }
 
+int create_ensemble(const shared_ptr<Bead>& model, istringstream& command) {
+    string template_name, table_name;
+    if(!get_input(command, template_name) || !get_input(command, table_name)) {
+        suanpan_info("create_ensemble() needs a template file and a parameter table.\n");
+        return 0;
+    }
+
+    auto thread_number = get_thread_number();
+    if(!command.eof() && !get_input(command, thread_number)) {
+        suanpan_info("create_ensemble() reads a wrong number of threads.\n");
+        return 0;
+    }
+
+    ifstream template_file(template_name);
+    if(!template_file.is_open()) {
+        suanpan_error("create_ensemble() cannot open the template file.\n");
+        return 0;
+    }
+
+    ifstream table_file(table_name);
+    if(!table_file.is_open()) {
+        suanpan_error("create_ensemble() cannot open the parameter table.\n");
+        return 0;
+    }
+
+    vector<string> template_line;
+    string command_line;
+    while(!getline(template_file, command_line).fail())
+        if(!command_line.empty() && command_line[0] != '#') template_line.emplace_back(command_line);
+
+    // $0 is replaced by the domain tag, $N is replaced by the N-th column of the row
+    const auto substitute = [](const string& line, const vector<string>& parameter) {
+        string new_line;
+        for(size_t I = 0; I < line.size(); ++I) {
+            if(line[I] != '$' || I + 1 == line.size() || !isdigit(line[I + 1])) {
+                new_line += line[I];
+                continue;
+            }
+            size_t index = 0;
+            while(I + 1 < line.size() && isdigit(line[I + 1])) index = 10 * index + size_t(line[++I] - '0');
+            if(index >= parameter.size()) {
+                suanpan_warning("create_ensemble() finds no column %u in row of Domain %s.\n", unsigned(index), parameter.front().c_str());
+                continue;
+            }
+            new_line += parameter[index];
+        }
+        return new_line;
+    };
+
+    const auto current_tag = model->get_current_domain_tag();
+
+    unsigned domain_tag = 1, counter = 0;
+    while(!getline(table_file, command_line).fail()) {
+        if(command_line.empty() || command_line[0] == '#') continue;
+
+        istringstream row(command_line);
+        vector<string> parameter;
+        string value;
+        while(get_input(row, value)) parameter.emplace_back(value);
+        if(parameter.empty()) continue;
+
+        // members take tags after existing domains
+        while(model->find_domain(++domain_tag)) {}
+        model->insert(make_shared<Domain>(domain_tag));
+        model->set_current_domain_tag(domain_tag);
+
+        parameter.insert(parameter.begin(), std::to_string(domain_tag));
+
+        for(const auto& I : template_line) {
+            istringstream tmp_str(substitute(I, parameter));
+            string command_id;
+            if(!get_input(tmp_str, command_id)) continue;
+            // members are analyzed together by the next analyze command
+            if(is_equal(command_id, "analyze") || is_equal(command_id, "domain") || is_equal(command_id, "ensemble") || is_equal(command_id, "exit") || is_equal(command_id, "quit")) continue;
+            tmp_str.clear();
+            tmp_str.seekg(0);
+            process_command(model, tmp_str);
+        }
+
+        ++counter;
+    }
+
+    model->set_current_domain_tag(current_tag);
+    model->set_thread_number(thread_number);
+
+    suanpan_info("create_ensemble() creates %u domains, which are analyzed by %u threads.\n", counter, thread_number);
+
+    return 0;
+}
+
 int disable_object(const shared_ptr<Bead>& model, istringstream& command) {
     const auto& domain = get_current_domain(model);
     if(domain == nullptr) {
@@ -647,8 +750,21 @@ int create_new_integrator(const shared_ptr<DomainBase>& domain, istringstream& c
             }
             if(domain->insert(make_shared<GeneralizedAlpha>(tag, alpha_m, alpha_f))) domain->set_current_integrator_tag(tag);
         }
-    } else if(integrator_type == "CentralDifference")
-        if(domain->insert(make_shared<CentralDifference>(tag))) domain->set_current_integrator_tag(tag);
+    } else if(integrator_type == "CentralDifference") {
+        auto t_integrator = make_shared<CentralDifference>(tag);
+        string lumping;
+        if(!command.eof() && get_input(command, lumping)) {
+            if(is_equal(lumping, "RowSum"))
+                t_integrator->set_lumping_scheme(LumpingScheme::ROWSUM);
+            else if(is_equal(lumping, "HRZ"))
+                t_integrator->set_lumping_scheme(LumpingScheme::HRZ);
+            else {
+                suanpan_info("create_new_integrator() needs a valid lumping scheme.\n");
+                return 0;
+            }
+        }
+        if(domain->insert(t_integrator)) domain->set_current_integrator_tag(tag);
+    }
 
     return 0;
 }
@@ -716,16 +832,52 @@ int create_new_recorder(const shared_ptr<DomainBase>& domain, istringstream& com
         return 0;
     }
 
-    unsigned object_tag;
-    if(!get_input(command, object_tag)) {
+    // object tags are given either individually or as ranges such as 5:100
+    vector<uword> object_tag;
+    string keyword;
+    while(get_input(command, keyword) && !is_equal(keyword, "stream")) {
+        const auto t_pos = keyword.find(':');
+        try {
+            if(t_pos == string::npos)
+                object_tag.emplace_back(std::stoul(keyword));
+            else {
+                const auto t_start = std::stoul(keyword.substr(0, t_pos));
+                const auto t_end = std::stoul(keyword.substr(t_pos + 1));
+                for(auto I = t_start; I <= t_end; ++I) object_tag.emplace_back(I);
+            }
+        } catch(const std::exception&) {
+            suanpan_info("create_new_recorder() needs a valid object tag.\n");
+            return 0;
+        }
+        keyword.clear();
+    }
+
+    if(object_tag.empty()) {
         suanpan_info("create_new_recorder() needs a valid object tag.\n");
         return 0;
     }
 
-    if(is_equal(object_type, "Node") && !domain->insert(make_shared<NodeRecorder>(tag, object_tag, to_list(variable_type.c_str()), true)))
-        suanpan_info("create_new_recorder() fails to create a new node recorder.\n");
-    else if(is_equal(object_type, "Element") && !domain->insert(make_shared<ElementRecorder>(tag, object_tag, to_list(variable_type.c_str()), true)))
-        suanpan_info("create_new_recorder() fails to create a new element recorder.\n");
+    shared_ptr<Recorder> new_recorder = nullptr;
+
+    if(is_equal(object_type, "Node"))
+        new_recorder = make_shared<NodeRecorder>(tag, uvec(object_tag), to_list(variable_type.c_str()), true);
+    else if(is_equal(object_type, "Element"))
+        new_recorder = make_shared<ElementRecorder>(tag, uvec(object_tag), to_list(variable_type.c_str()), true);
+
+    if(new_recorder == nullptr) {
+        suanpan_info("create_new_recorder() cannot identify object type.\n");
+        return 0;
+    }
+
+    // optional streaming mode: stream [$chunk_size] [$compression_level]
+    if(is_equal(keyword, "stream")) {
+        unsigned chunk_size = 1000, compression = 0;
+        if(!command.eof() && !get_input(command, chunk_size)) chunk_size = 1000;
+        if(!command.eof() && !get_input(command, compression)) compression = 0;
+        new_recorder->set_stream(std::max(1u, chunk_size), compression);
+    }
+
+    if(!domain->insert(new_recorder)) suanpan_info("create_new_recorder() fails to create a new recorder.\n");
 
     return 0;
 }
@@ -838,6 +990,71 @@ int create_new_step(const shared_ptr<DomainBase>& domain, istringstream& command
             domain->set_current_step_tag(tag);
         else
             suanpan_error("create_new_step() cannot create the new step.\n");
+    } else if(is_equal(step_type, "Explicit") || is_equal(step_type, "ExplicitDynamic")) {
+        auto time = 1.;
+        if(!command.eof() && !get_input(command, time)) {
+            suanpan_info("create_new_step() reads a wrong time period.\n");
+            return 0;
+        }
+        if(domain->insert(make_shared<ExplicitDynamic>(tag, time)))
+            domain->set_current_step_tag(tag);
+        else
+            suanpan_error("create_new_step() cannot create the new step.\n");
+    } else if(is_equal(step_type, "Modal") || is_equal(step_type, "ModalDynamic")) {
+        auto time = 1.;
+        if(!command.eof() && !get_input(command, time)) {
+            suanpan_info("create_new_step() reads a wrong time period.\n");
+            return 0;
+        }
+        unsigned mode_number = 10;
+        if(!command.eof() && !get_input(command, mode_number)) {
+            suanpan_info("create_new_step() reads a wrong number of modes.\n");
+            return 0;
+        }
+        auto damping_ratio = 0.;
+        if(!command.eof() && !get_input(command, damping_ratio)) {
+            suanpan_info("create_new_step() reads a wrong damping ratio.\n");
+            return 0;
+        }
+        if(domain->insert(make_shared<ModalDynamic>(tag, time, mode_number, damping_ratio)))
+            domain->set_current_step_tag(tag);
+        else
+            suanpan_error("create_new_step() cannot create the new step.\n");
+    } else if(is_equal(step_type, "BatchStatic") || is_equal(step_type, "BatchDynamic")) {
+        auto time = 1.;
+        if(!command.eof() && !get_input(command, time)) {
+            suanpan_info("create_new_step() reads a wrong time period.\n");
+            return 0;
+        }
+        if(domain->insert(make_shared<Batch>(tag, time, is_equal(step_type, "BatchDynamic"))))
+            domain->set_current_step_tag(tag);
+        else
+            suanpan_error("create_new_step() cannot create the new step.\n");
+    } else if(is_equal(step_type, "Frequency")) {
+        unsigned eigen_number = 1;
+        if(!command.eof() && !get_input(command, eigen_number)) {
+            suanpan_info("create_new_step() reads a wrong number of eigenvalues.\n");
+            return 0;
+        }
+        auto shift = 0.;
+        if(!command.eof() && !get_input(command, shift)) {
+            suanpan_info("create_new_step() reads a wrong shift.\n");
+            return 0;
+        }
+        if(domain->insert(make_shared<Frequence>(tag, eigen_number, shift)))
+            domain->set_current_step_tag(tag);
+        else
+            suanpan_error("create_new_step() cannot create the new step.\n");
+    } else if(is_equal(step_type, "Buckle") || is_equal(step_type, "Buckling")) {
+        unsigned eigen_number = 1;
+        if(!command.eof() && !get_input(command, eigen_number)) {
+            suanpan_info("create_new_step() reads a wrong number of eigenvalues.\n");
+            return 0;
+        }
+        if(domain->insert(make_shared<Buckle>(tag, eigen_number)))
+            domain->set_current_step_tag(tag);
+        else
+            suanpan_error("create_new_step() cannot create the new step.\n");
     } else if(is_equal(step_type, "ArcLength")) {
         unsigned node;
         if(!get_input(command, node)) {
@@ -868,16 +1085,31 @@ int create_new_step(const shared_ptr<DomainBase>& domain, istringstream& command
 }
 
 int set_property(const shared_ptr<DomainBase>& domain, istringstream& command) {
-    if(domain->get_current_step_tag() == 0) return 0;
-
-    const auto& tmp_step = domain->get_current_step();
-
     string property_id;
     if(!get_input(command, property_id)) {
         suanpan_info("set_property() need a property type.\n");
         return 0;
     }
 
+    // thread settings are global and do not need a step
+    if(is_equal(property_id, "thread_number")) {
+        unsigned value;
+        if(get_input(command, value) && value > 0)
+            ThreadPool::get_pool().resize(value);
+        else
+            suanpan_info("set_property() need a valid value.\n");
+        return 0;
+    }
+    if(is_equal(property_id, "thread_affinity")) {
+        string value;
+        get_input(command, value) ? ThreadPool::get_pool().set_affinity(is_true(value)) : suanpan_info("set_property() need a valid value.\n");
+        return 0;
+    }
+
+    if(domain->get_current_step_tag() == 0) return 0;
+
+    const auto& tmp_step = domain->get_current_step();
+
     if(is_equal(property_id, "fixed_step_size")) {
         string value;
         get_input(command, value) ? tmp_step->set_fixed_step_size(is_true(value)) : suanpan_info("set_property() need a valid value.\n");
@@ -887,6 +1119,9 @@ int set_property(const shared_ptr<DomainBase>& domain, istringstream& command) {
     } else if(is_equal(property_id, "band_mat")) {
         string value;
         get_input(command, value) ? tmp_step->set_band(is_true(value)) : suanpan_info("set_property() need a valid value.\n");
+    } else if(is_equal(property_id, "sparse_mat")) {
+        string value;
+        get_input(command, value) ? tmp_step->set_sparse(is_true(value)) : suanpan_info("set_property() need a valid value.\n");
     } else if(is_equal(property_id, "ini_step_size")) {
         double step_time;
         get_input(command, step_time) ? tmp_step->set_ini_step_size(step_time) : suanpan_info("set_property() need a valid value.\n");
@@ -899,8 +1134,106 @@ int set_property(const shared_ptr<DomainBase>& domain, istringstream& command) {
     } else if(is_equal(property_id, "max_iteration")) {
         unsigned max_number;
         get_input(command, max_number) ? tmp_step->set_max_substep(max_number) : suanpan_info("set_property() need a valid value.\n");
+    } else if(is_equal(property_id, "iterative_solver")) {
+        string value;
+        if(!get_input(command, value))
+            suanpan_info("set_property() need a valid value.\n");
+        else if(is_equal(value, "PCG"))
+            tmp_step->set_iterative_solver(IterativeSolver::PCG);
+        else if(is_equal(value, "BiCGStab"))
+            tmp_step->set_iterative_solver(IterativeSolver::BICGSTAB);
+        else if(is_equal(value, "GMRES"))
+            tmp_step->set_iterative_solver(IterativeSolver::GMRES);
+        else if(is_equal(value, "None"))
+            tmp_step->set_iterative_solver(IterativeSolver::NONE);
+        else
+            suanpan_info("set_property() need a valid value.\n");
+    } else if(is_equal(property_id, "preconditioner")) {
+        string value;
+        if(!get_input(command, value))
+            suanpan_info("set_property() need a valid value.\n");
+        else if(is_equal(value, "Jacobi"))
+            tmp_step->set_preconditioner(PreconditionerType::JACOBI);
+        else if(is_equal(value, "ILU") || is_equal(value, "IC"))
+            tmp_step->set_preconditioner(PreconditionerType::ILU);
+        else if(is_equal(value, "AMG"))
+            tmp_step->set_preconditioner(PreconditionerType::AMG);
+        else if(is_equal(value, "None"))
+            tmp_step->set_preconditioner(PreconditionerType::NONE);
+        else
+            suanpan_info("set_property() need a valid value.\n");
+    } else if(is_equal(property_id, "iterative_tolerance")) {
+        double tolerance;
+        get_input(command, tolerance) ? tmp_step->set_iterative_tolerance(tolerance) : suanpan_info("set_property() need a valid value.\n");
+    } else if(is_equal(property_id, "iterative_max_iteration")) {
+        unsigned max_number;
+        get_input(command, max_number) ? tmp_step->set_iterative_max_iteration(max_number) : suanpan_info("set_property() need a valid value.\n");
+    }
+
+    return 0;
+}
+
+int set_profile(istringstream& command) {
+    string option = "print";
+    if(!command.eof() && !get_input(command, option)) {
+        suanpan_info("set_profile() needs a valid option.\n");
+        return 0;
+    }
+
+    if(is_equal(option, "print"))
+        profiler::print();
+    else if(is_true(option))
+        profiler::enable(true);
+    else if(is_false(option))
+        profiler::enable(false);
+    else if(is_equal(option, "clear"))
+        profiler::clear();
+    else if(is_equal(option, "save") || is_equal(option, "report")) {
+        string file_name;
+        if(!get_input(command, file_name)) {
+            suanpan_info("set_profile() needs a valid file name.\n");
+            return 0;
+        }
+        if(is_equal(option, "save"))
+            profiler::save(file_name);
+        else {
+            // the report is written at exit, profiling is switched on as well
+            profiler::set_report(file_name);
+            profiler::enable(true);
+        }
+    } else
+        suanpan_info("set_profile() cannot identify the option.\n");
+
+    return 0;
+}
+
+int set_checkpoint(const shared_ptr<DomainBase>& domain, istringstream& command) {
+    string file_name;
+    if(!get_input(command, file_name)) {
+        suanpan_info("set_checkpoint() needs a valid file name.\n");
+        return 0;
+    }
+
+    unsigned interval = 1;
+    if(!command.eof() && !get_input(command, interval)) {
+        suanpan_info("set_checkpoint() needs a valid interval.\n");
+        return 0;
+    }
+
+    domain->set_checkpoint(make_shared<HDF>(0, file_name), interval);
+
+    return 0;
+}
+
+int set_restart(const shared_ptr<DomainBase>& domain, istringstream& command) {
+    string file_name;
+    if(!get_input(command, file_name)) {
+        suanpan_info("set_restart() needs a valid file name.\n");
+        return 0;
     }
 
+    domain->set_restart(make_shared<HDF>(0, file_name));
+
     return 0;
 }
 
@@ -950,18 +1283,66 @@ void print_command_usage(istringstream& command) {
     string command_id;
     command >> command_id;
 
-    if(is_equal(command_id, "converger")) {
+    if(is_equal(command_id, "convert")) {
+        suanpan_info("\nconvert $input_file $output_file\n");
+        suanpan_info("\t$input_file --- text model file\n");
+        suanpan_info("\t$output_file --- binary model file, it is loaded by the file command if it ends with .h5\n\n");
+    } else if(is_equal(command_id, "converger")) {
         suanpan_info("\nconverger $type $tag $tolerance [$max_iteration] [$if_print]\n");
         suanpan_info("\t$type --- converger type\n");
         suanpan_info("\t$tag --- converger tag\n");
         suanpan_info("\t$tolerance --- tolerance -> 1E-8\n");
         suanpan_info("\t$max_iteration --- maximum iteration number -> 7\n");
         suanpan_info("\t$if_print --- print error in each iteration -> false\n\n");
+    } else if(is_equal(command_id, "elementgrid")) {
+        suanpan_info("\nelementgrid $type $dimension {$number} {$node_increment} $tag {$node_tag} [$other_arguments...]\n");
+        suanpan_info("\t$type --- built-in element type\n");
+        suanpan_info("\t$dimension --- number of grid axes, 1, 2 or 3\n");
+        suanpan_info("\t$number --- number of elements along each axis\n");
+        suanpan_info("\t$node_increment --- node tag increment between neighbouring elements along each axis\n");
+        suanpan_info("\t$tag $node_tag $other_arguments --- definition of the first element, the I-th element has the tag of $tag+I\n\n");
+    } else if(is_equal(command_id, "ensemble")) {
+        suanpan_info("\nensemble $template_file $table_file [$thread_number]\n");
+        suanpan_info("\t$template_file --- model commands, $0 is the domain tag and $N is the N-th column of the row\n");
+        suanpan_info("\t$table_file --- parameter table, each row creates one domain\n");
+        suanpan_info("\t$thread_number --- number of domains analyzed concurrently -> hardware concurrency\n\n");
+    } else if(is_equal(command_id, "nodecopy")) {
+        suanpan_info("\nnodecopy $start_tag $end_tag $tag_increment $repeat {$increment}\n");
+        suanpan_info("\t$start_tag $end_tag --- range of tags of nodes to be copied\n");
+        suanpan_info("\t$tag_increment --- tag increment between two copies\n");
+        suanpan_info("\t$repeat --- number of copies\n");
+        suanpan_info("\t$increment --- coordinate increment between two copies\n\n");
+    } else if(is_equal(command_id, "nodegrid")) {
+        suanpan_info("\nnodegrid $tag $dimension {$number} {$origin} {$spacing}\n");
+        suanpan_info("\t$tag --- tag of the first node, the I-th node has the tag of $tag+I\n");
+        suanpan_info("\t$dimension --- number of grid axes, 1, 2 or 3\n");
+        suanpan_info("\t$number --- number of nodes along each axis\n");
+        suanpan_info("\t$origin --- coordinates of the first node\n");
+        suanpan_info("\t$spacing --- node spacing along each axis\n\n");
+    } else if(is_equal(command_id, "nodemirror")) {
+        suanpan_info("\nnodemirror $start_tag $end_tag $tag_increment $axis $position\n");
+        suanpan_info("\t$start_tag $end_tag --- range of tags of nodes to be mirrored\n");
+        suanpan_info("\t$tag_increment --- tag increment of mirrored nodes\n");
+        suanpan_info("\t$axis --- axis normal to the mirror plane, 1, 2 or 3\n");
+        suanpan_info("\t$position --- coordinate of the mirror plane along the axis\n\n");
+    } else if(is_equal(command_id, "profile")) {
+        suanpan_info("\nprofile [$option] [$file_name]\n");
+        suanpan_info("\t$option --- on, off, clear, print, save or report -> print\n");
+        suanpan_info("\t$file_name --- output file of save (now) and report (at exit), CSV if it ends with .csv otherwise JSON\n\n");
+    } else if(is_equal(command_id, "set")) {
+        suanpan_info("\nset thread_number $value\n");
+        suanpan_info("\t$value --- number of threads used by parallel loops and BLAS -> hardware concurrency\n");
+        suanpan_info("\nset thread_affinity $value\n");
+        suanpan_info("\t$value --- if to pin worker threads to cores (Linux only) -> false\n\n");
     } else if(is_equal(command_id, "step")) {
         suanpan_info("\nstep $type $tag [$time_period]\n");
         suanpan_info("\t$type --- step type\n");
         suanpan_info("\t$tag --- step tag\n");
-        suanpan_info("\t$time_period --- step time period -> 1.0\n\n");
+        suanpan_info("\t$time_period --- step time period -> 1.0\n");
+        suanpan_info("\nstep Frequency $tag [$eigen_number] [$shift]\n");
+        suanpan_info("\t$tag --- step tag\n");
+        suanpan_info("\t$eigen_number --- number of eigenvalues -> 1\n");
+        suanpan_info("\t$shift --- eigenvalues closest to the shift are computed -> 0.0\n\n");
     } else if(is_equal(command_id, "Truss2D")) {
         suanpan_info("\nelement Truss2D $tag {$node_tag...} $material_tag $area [$nonlinear_switch] [$constant_area_switch] [$log_strain_switch]\n");
         suanpan_info("\t$tag --- element tag\n");
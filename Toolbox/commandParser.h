@@ -29,6 +29,7 @@ int process_file(const shared_ptr<Bead>&, const char*);
 int process_file(const shared_ptr<Bead>&, istringstream&);
 
 int create_new_domain(const shared_ptr<Bead>&, istringstream&);
+int create_ensemble(const shared_ptr<Bead>&, istringstream&);
 
 int disable_object(const shared_ptr<Bead>&, istringstream&);
 int enable_object(const shared_ptr<Bead>&, istringstream&);
@@ -53,6 +54,11 @@ int create_new_step(const shared_ptr<DomainBase>&, istringstream&);
 
 int set_property(const shared_ptr<DomainBase>&, istringstream&);
 
+int set_profile(istringstream&);
+
+int set_checkpoint(const shared_ptr<DomainBase>&, istringstream&);
+int set_restart(const shared_ptr<DomainBase>&, istringstream&);
+
 int print_info(const shared_ptr<DomainBase>&, istringstream&);
 
 void print_command_usage(istringstream&);
@@ -0,0 +1,216 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2017 Theodore Chang
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "meshGenerator.h"
+#include <Domain/DomainBase.h>
+#include <Domain/Node.h>
+#include <Element/Element.h>
+#include <Element/ElementParser.h>
+#include <Toolbox/ThreadPool.h>
+#include <Toolbox/utility.h>
+
+using std::vector;
+
+namespace {
+// number of objects along each axis, the first axis runs fastest
+bool get_grid(istringstream& command, const char* caller, unsigned& dimension, uvec& number) {
+    if(!get_input(command, dimension) || dimension == 0 || dimension > 3) {
+        suanpan_info("%s() needs a valid dimension (1, 2 or 3).\n", caller);
+        return false;
+    }
+
+    number.set_size(dimension);
+    for(auto& I : number)
+        if(!get_input(command, I) || I == 0) {
+            suanpan_info("%s() needs %u positive numbers.\n", caller, dimension);
+            return false;
+        }
+
+    return true;
+}
+
+uvec get_index(uword I, const uvec& number) {
+    uvec index(number.n_elem);
+    for(uword J = 0; J < number.n_elem; ++J) {
+        index(J) = I % number(J);
+        I /= number(J);
+    }
+    return index;
+}
+
+vector<shared_ptr<Node>> get_node_set(const shared_ptr<DomainBase>& domain, const unsigned start_tag, const unsigned end_tag) {
+    vector<shared_ptr<Node>> node_set;
+    for(auto I = start_tag; I <= end_tag && I >= start_tag; ++I)
+        if(domain->find_node(I)) node_set.emplace_back(domain->get_node(I));
+    return node_set;
+}
+}
+
+int create_node_grid(const shared_ptr<DomainBase>& domain, istringstream& command) {
+    unsigned tag;
+    if(!get_input(command, tag)) {
+        suanpan_info("create_node_grid() needs a tag.\n");
+        return 0;
+    }
+
+    unsigned dimension;
+    uvec number;
+    if(!get_grid(command, "create_node_grid", dimension, number)) return 0;
+
+    vec origin(dimension), spacing(dimension);
+    for(auto& I : origin)
+        if(!get_input(command, I)) {
+            suanpan_info("create_node_grid() needs %u origin coordinates.\n", dimension);
+            return 0;
+        }
+    for(auto& I : spacing)
+        if(!get_input(command, I)) {
+            suanpan_info("create_node_grid() needs %u spacings.\n", dimension);
+            return 0;
+        }
+
+    vector<shared_ptr<Node>> new_node(prod(number));
+    parallel_for(new_node.size(), [&](const size_t I) { new_node[I] = make_shared<Node>(unsigned(tag + I), vec(origin + spacing % conv_to<vec>::from(get_index(I, number)))); });
+
+    if(!domain->insert(new_node)) suanpan_debug("create_node_grid() fails to insert some nodes.\n");
+
+    return 0;
+}
+
+int copy_node(const shared_ptr<DomainBase>& domain, istringstream& command) {
+    unsigned start_tag, end_tag, tag_increment;
+    if(!get_input(command, start_tag) || !get_input(command, end_tag) || !get_input(command, tag_increment)) {
+        suanpan_info("copy_node() needs a range of node tags and a tag increment.\n");
+        return 0;
+    }
+
+    unsigned repeat;
+    if(!get_input(command, repeat)) {
+        suanpan_info("copy_node() needs a valid number of copies.\n");
+        return 0;
+    }
+
+    vector<double> increment;
+    double X;
+    while(get_input(command, X)) increment.push_back(X);
+
+    const auto node_set = get_node_set(domain, start_tag, end_tag);
+
+    // K-th copy is shifted by K times of the increments
+    vector<shared_ptr<Node>> new_node(node_set.size() * repeat);
+    parallel_for(new_node.size(), [&](const size_t I) {
+        const auto& t_node = node_set[I % node_set.size()];
+        const auto t_copy = unsigned(I / node_set.size() + 1);
+        vec t_coor = t_node->get_coordinate();
+        for(uword J = 0; J < std::min(t_coor.n_elem, uword(increment.size())); ++J) t_coor(J) += t_copy * increment[J];
+        new_node[I] = make_shared<Node>(t_node->get_tag() + t_copy * tag_increment, t_coor);
+    });
+
+    if(!domain->insert(new_node)) suanpan_debug("copy_node() fails to insert some nodes.\n");
+
+    return 0;
+}
+
+int mirror_node(const shared_ptr<DomainBase>& domain, istringstream& command) {
+    unsigned start_tag, end_tag, tag_increment;
+    if(!get_input(command, start_tag) || !get_input(command, end_tag) || !get_input(command, tag_increment)) {
+        suanpan_info("mirror_node() needs a range of node tags and a tag increment.\n");
+        return 0;
+    }
+
+    unsigned axis;
+    if(!get_input(command, axis) || axis == 0 || axis > 3) {
+        suanpan_info("mirror_node() needs a valid axis (1, 2 or 3).\n");
+        return 0;
+    }
+
+    double position;
+    if(!get_input(command, position)) {
+        suanpan_info("mirror_node() needs a valid position of the mirror plane.\n");
+        return 0;
+    }
+
+    const auto node_set = get_node_set(domain, start_tag, end_tag);
+
+    vector<shared_ptr<Node>> new_node(node_set.size());
+    parallel_for(new_node.size(), [&](const size_t I) {
+        vec t_coor = node_set[I]->get_coordinate();
+        if(axis <= t_coor.n_elem) t_coor(axis - 1) = 2. * position - t_coor(axis - 1);
+        new_node[I] = make_shared<Node>(node_set[I]->get_tag() + tag_increment, t_coor);
+    });
+
+    if(!domain->insert(new_node)) suanpan_debug("mirror_node() fails to insert some nodes.\n");
+
+    return 0;
+}
+
+int create_element_grid(const shared_ptr<DomainBase>& domain, istringstream& command) {
+    string element_id;
+    if(!get_input(command, element_id)) {
+        suanpan_info("create_element_grid() needs element type.\n");
+        return 0;
+    }
+
+    unsigned dimension;
+    uvec number;
+    if(!get_grid(command, "create_element_grid", dimension, number)) return 0;
+
+    uvec node_increment(dimension);
+    for(auto& I : node_increment)
+        if(!get_input(command, I)) {
+            suanpan_info("create_element_grid() needs %u node increments.\n", dimension);
+            return 0;
+        }
+
+    // the rest is the definition of the first element
+    vector<string> token;
+    string T;
+    while(get_input(command, T)) token.push_back(T);
+
+    string t_definition;
+    for(const auto& I : token) t_definition += (t_definition.empty() ? "" : " ") + I;
+
+    istringstream t_first(t_definition);
+    unique_ptr<Element> t_element;
+    if(!new_element_object(t_element, element_id, t_first)) {
+        suanpan_info("create_element_grid() only supports built-in element types.\n");
+        return 0;
+    }
+    if(t_element == nullptr) {
+        suanpan_info("create_element_grid() cannot create the first element.\n");
+        return 0;
+    }
+
+    const auto& num_node = t_element->get_node_number();
+    const auto& tag = t_element->get_tag();
+    const auto& node_tag = t_element->get_node_encoding();
+
+    // tag and nodes vary, other arguments are shared
+    string t_rest;
+    for(auto I = size_t(num_node) + 1; I < token.size(); ++I) t_rest += " " + token[I];
+
+    vector<string> argument(prod(number));
+    parallel_for(argument.size(), [&](const size_t I) {
+        const auto t_offset = dot(get_index(I, number), node_increment);
+        auto& t_argument = argument[I];
+        t_argument = std::to_string(tag + I);
+        for(const auto& J : node_tag) t_argument += " " + std::to_string(J + t_offset);
+        t_argument += t_rest;
+    });
+
+    return create_element_batch(domain, element_id, argument);
+}
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright (C) 2017 Theodore Chang
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ ******************************************************************************/
+/**
+ * @fn meshGenerator
+ * @brief Commands that generate nodes and elements of structured meshes.
+ *
+ * Objects are created concurrently and inserted into the domain in batches.
+ *
+ * ```
+ *     nodegrid $tag $dimension {$number} {$origin} {$spacing}
+ *     nodecopy $start_tag $end_tag $tag_increment $repeat {$increment}
+ *     nodemirror $start_tag $end_tag $tag_increment $axis $position
+ *     elementgrid $type $dimension {$number} {$node_increment} $tag {$node_tag} [$other_arguments...]
+ * ```
+ *
+ * The I-th node of a grid has the tag of `$tag + I_1 + N_1 * (I_2 + N_2 * I_3)`,
+ * elements of a grid are numbered in the same way. Each element of the grid
+ * shifts the node tags of the first element by the node increments. For
+ * example, a block of 10x10x10 C3D8 elements is generated by
+ *
+ * ```
+ *     nodegrid 1 3 11 11 11 0 0 0 .1 .1 .1
+ *     elementgrid C3D8 3 10 10 10 1 11 121 1 1 2 13 12 122 123 134 133 1
+ * ```
+ *
+ * `nodecopy` copies the nodes within the given range of tags `$repeat` times,
+ * which translates the set or, combined with `elementgrid`, extrudes a mesh.
+ *
+ * @author T
+ * @date 22/11/2017
+ * @version 0.1.0
+ * @file meshGenerator.h
+ * @addtogroup Utility
+ * @{
+ */
+
+#ifndef MESHGENERATOR_H
+#define MESHGENERATOR_H
+
+#include <suanPan.h>
+
+class DomainBase;
+
+int create_node_grid(const shared_ptr<DomainBase>&, istringstream&);
+int copy_node(const shared_ptr<DomainBase>&, istringstream&);
+int mirror_node(const shared_ptr<DomainBase>&, istringstream&);
+
+int create_element_grid(const shared_ptr<DomainBase>&, istringstream&);
+
+#endif
+
+//! @}
@@ -17,14 +17,14 @@
 
 #include "tensorToolbox.h"
 
-vec tensor::unit_tensor2() {
-    vec T(6, fill::zeros);
+vec6 tensor::unit_tensor2() {
+    vec6 T(fill::zeros);
     T(0) = T(1) = T(2) = 1.;
     return T;
 }
 
-mat tensor::unit_deviatoric_tensor4() {
-    mat T = zeros(6, 6);
+mat66 tensor::unit_deviatoric_tensor4() {
+    mat66 T(fill::zeros);
 
     for(auto I = 3; I < 6; ++I) T(I, I) = .5;
 
@@ -34,8 +34,8 @@ mat tensor::unit_deviatoric_tensor4() {
     return T;
 }
 
-mat tensor::unit_symmetric_tensor4() {
-    mat T = zeros(6, 6);
+mat66 tensor::unit_symmetric_tensor4() {
+    mat66 T(fill::zeros);
 
     for(auto I = 0; I < 3; ++I) T(I, I) = 1.;
     for(auto I = 3; I < 6; ++I) T(I, I) = .5;
@@ -66,11 +66,11 @@ double tensor::mean(const vec& S) {
     return trace(S) / 3.;
 }
 
-vec tensor::dev(const vec& S) {
+vec6 tensor::dev(const vec& S) {
     if(S.n_elem != 6) throw;
 
-    auto D = S;
-    const auto M = mean(D);
+    vec6 D(S);
+    const auto M = mean(S);
     for(auto I = 0; I < 3; ++I) D(I) -= M;
 
     return D;
@@ -81,8 +81,7 @@ double tensor::norm(const vec& in) {
 
     auto out = 0.;
 
-    const vec square_in = square(in);
-    for(auto I = 0; I < 3; ++I) out += square_in(I) + 2. * square_in(I + 3);
+    for(auto I = 0; I < 3; ++I) out += in(I) * in(I) + 2. * in(I + 3) * in(I + 3);
 
     return out;
 }
@@ -93,8 +92,8 @@ mat tensor::dev(const mat& in) {
     return out;
 }
 
-mat tensor::strain::to_tensor(const vec& in_strain) {
-    mat out_strain(3, 3);
+mat33 tensor::strain::to_tensor(const vec& in_strain) {
+    mat33 out_strain;
 
     out_strain(0, 0) = in_strain(0);
     out_strain(1, 1) = in_strain(1);
@@ -106,8 +105,8 @@ mat tensor::strain::to_tensor(const vec& in_strain) {
     return out_strain;
 }
 
-vec tensor::strain::to_voigt(const mat& in_strain) {
-    vec out_strain(6);
+vec6 tensor::strain::to_voigt(const mat& in_strain) {
+    vec6 out_strain;
 
     out_strain(0) = in_strain(0, 0);
     out_strain(1) = in_strain(1, 1);
@@ -119,8 +118,8 @@ vec tensor::strain::to_voigt(const mat& in_strain) {
     return out_strain;
 }
 
-mat tensor::stress::to_tensor(const vec& in_stress) {
-    mat out_stress(3, 3);
+mat33 tensor::stress::to_tensor(const vec& in_stress) {
+    mat33 out_stress;
 
     out_stress(0, 0) = in_stress(0);
     out_stress(1, 1) = in_stress(1);
@@ -132,8 +131,8 @@ mat tensor::stress::to_tensor(const vec& in_stress) {
     return out_stress;
 }
 
-vec tensor::stress::to_voigt(const mat& in_stress) {
-    vec out_stress(6);
+vec6 tensor::stress::to_voigt(const mat& in_stress) {
+    vec6 out_stress;
 
     out_stress(0) = in_stress(0, 0);
     out_stress(1) = in_stress(1, 1);
@@ -149,14 +148,14 @@ double transform::atan2(const vec& direction_cosine) { return std::atan2(directi
 
 double transform::strain::angle(const vec& strain) { return .5 * std::atan2(strain(2), strain(0) - strain(1)); }
 
-mat transform::strain::trans(const double angle) {
+mat33 transform::strain::trans(const double angle) {
     const auto sin_angle = sin(angle);
     const auto cos_angle = cos(angle);
     const auto sin_sin = sin_angle * sin_angle;
     const auto cos_cos = cos_angle * cos_angle;
     const auto sin_cos = sin_angle * cos_angle;
 
-    mat trans(3, 3);
+    mat33 trans;
     trans(0, 0) = trans(1, 1) = cos_cos;
     trans(0, 1) = trans(1, 0) = sin_sin;
     trans(1, 2) = -(trans(0, 2) = sin_cos);
@@ -166,11 +165,11 @@ mat transform::strain::trans(const double angle) {
     return trans;
 }
 
-vec transform::strain::principal(const vec& strain) {
+vec3 transform::strain::principal(const vec& strain) {
     const auto tmp_a = .5 * (strain(0) + strain(1));
     const auto tmp_b = .5 * sqrt(pow(strain(0) - strain(1), 2.) + pow(strain(2), 2.));
 
-    vec p_strain(3);
+    vec3 p_strain;
     p_strain(0) = tmp_a + tmp_b;
     p_strain(1) = tmp_a - tmp_b;
     p_strain(2) = 0.;
@@ -182,14 +181,14 @@ vec transform::strain::rotate(const vec& strain, const double theta) { return tr
 
 double transform::stress::angle(const vec& stress) { return .5 * std::atan2(2. * stress(2), stress(0) - stress(1)); }
 
-mat transform::stress::trans(const double angle) {
+mat33 transform::stress::trans(const double angle) {
     const auto sin_angle = sin(angle);
     const auto cos_angle = cos(angle);
     const auto sin_sin = sin_angle * sin_angle;
     const auto cos_cos = cos_angle * cos_angle;
     const auto sin_cos = sin_angle * cos_angle;
 
-    mat trans(3, 3);
+    mat33 trans;
     trans(0, 0) = trans(1, 1) = cos_cos;
     trans(0, 1) = trans(1, 0) = sin_sin;
     trans(1, 2) = -(trans(0, 2) = 2. * sin_cos);
@@ -199,11 +198,11 @@ mat transform::stress::trans(const double angle) {
     return trans;
 }
 
-vec transform::stress::principal(const vec& stress) {
+vec3 transform::stress::principal(const vec& stress) {
     const auto tmp_a = .5 * (stress(0) + stress(1));
     const auto tmp_b = .5 * sqrt(pow(stress(0) - stress(1), 2.) + pow(2. * stress(2), 2.));
 
-    vec p_stress(3);
+    vec3 p_stress;
     p_stress(0) = tmp_a + tmp_b;
     p_stress(1) = tmp_a - tmp_b;
     p_stress(2) = 0.;
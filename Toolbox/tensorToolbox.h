@@ -20,10 +20,11 @@
 
 #include <suanPan.h>
 
+// small tensors are returned in fixed size types, which live on stack and need no heap allocation
 namespace tensor {
-vec unit_tensor2();
-mat unit_deviatoric_tensor4();
-mat unit_symmetric_tensor4();
+vec6 unit_tensor2();
+mat66 unit_deviatoric_tensor4();
+mat66 unit_symmetric_tensor4();
 
 // applies to principal tensor
 double invariant1(const vec&);
@@ -37,18 +38,18 @@ double invariant3(const mat&);
 
 double trace(const vec&);
 double mean(const vec&);
-vec dev(const vec&);
+vec6 dev(const vec&);
 double norm(const vec&);
 
 mat dev(const mat&);
 
 namespace strain {
-    mat to_tensor(const vec&);
-    vec to_voigt(const mat&);
+    mat33 to_tensor(const vec&);
+    vec6 to_voigt(const mat&);
 }
 namespace stress {
-    mat to_tensor(const vec&);
-    vec to_voigt(const mat&);
+    mat33 to_tensor(const vec&);
+    vec6 to_voigt(const mat&);
 }
 }
 
@@ -56,14 +57,14 @@ namespace transform {
 double atan2(const vec&);
 namespace strain {
     double angle(const vec&);
-    mat trans(const double);
-    vec principal(const vec&);
+    mat33 trans(const double);
+    vec3 principal(const vec&);
     vec rotate(const vec&, const double);
 }
 namespace stress {
     double angle(const vec&);
-    mat trans(const double);
-    vec principal(const vec&);
+    mat33 trans(const double);
+    vec3 principal(const vec&);
     vec rotate(const vec&, const double);
 }
 namespace beam {
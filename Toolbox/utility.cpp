@@ -16,8 +16,15 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "utility.h"
+#include <atomic>
 #include <cstring>
 #include <suanPan.h>
+#include <thread>
+
+namespace {
+std::atomic<unsigned> thread_number(std::max(1u, std::thread::hardware_concurrency()));
+thread_local unsigned thread_limit = 0;
+}
 
 bool is_equal(const char* A, const char* B) { return _strcmpi(A, B) == 0; }
 
@@ -32,3 +39,14 @@ bool is_false(const char* S) { return is_equal(S, "Off") || is_equal(S, "False")
 bool is_true(const string& S) { return is_true(S.c_str()); }
 
 bool is_false(const string& S) { return is_false(S.c_str()); }
+
+unsigned get_thread_number() { return thread_limit != 0 ? thread_limit : thread_number.load(); }
+
+void set_thread_number(const unsigned& N) { thread_number = std::max(1u, N); }
+
+void set_thread_limit(const unsigned& N) { thread_limit = N; }
+
+std::mutex& get_hdf5_mutex() {
+    static std::mutex hdf5_mutex;
+    return hdf5_mutex;
+}
@@ -19,6 +19,7 @@
 #define UTILITY_H
 
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 
@@ -52,6 +53,23 @@ bool is_false(const char*);
 bool is_true(const string&);
 bool is_false(const string&);
 
+/**
+ * \brief Number of threads a parallel loop may use in the calling thread.
+ * It defaults to the size of the thread pool, which is set by
+ * set_thread_number(). Workers that already run in parallel, such as ensemble
+ * members, set a limit so that nested loops do not oversubscribe the machine.
+ * The limit is local to the calling thread.
+ */
+unsigned get_thread_number();
+void set_thread_number(const unsigned&);
+void set_thread_limit(const unsigned&);
+
+/**
+ * \brief The bundled HDF5 library is not thread safe, calls from concurrent
+ * domains are guarded by this mutex.
+ */
+std::mutex& get_hdf5_mutex();
+
 template <typename T> struct deep_ptr : std::unique_ptr<T> {
     using std::unique_ptr<T>::unique_ptr;
     deep_ptr() {}
@@ -49,6 +49,8 @@ int main(int argc, char** argv) {
     // D.col(2) = vec{ E };
     // D.save("K", raw_ascii);
 
+    profiler::report();
+
     suanpan_info("Finished in %.3F seconds.\n", T.toc());
 
     return 0;